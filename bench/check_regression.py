@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2019 Masashi Fujita
+#
+"""Compares the throughputs recorded by `run-bench-tiger` against a baseline.
+
+Usage: check_regression.py BASELINE CURRENT [--tolerance PERCENT] [--filter REGEX]
+
+Both files are the JSON outputs of Google Benchmark.  A benchmark regresses
+when its `bytes_per_second` (or `items_per_second`) drops more than the
+tolerance below the baseline.  Exits with 1 on any regression.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+
+def throughputs(path, pattern):
+    with open(path) as f:
+        report = json.load(f)
+    result = {}
+    for bm in report.get("benchmarks", []):
+        # Takes the means of the repetitions (or the single runs).
+        if bm.get("run_type") == "aggregate" and bm.get("aggregate_name") != "mean":
+            continue
+        name = bm.get("run_name", bm["name"])
+        if not pattern.search(name):
+            continue
+        for key in ("bytes_per_second", "items_per_second"):
+            if key in bm:
+                result[name] = (key, float(bm[key]))
+                break
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Checks the benchmark results for throughput regressions.")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--tolerance", type=float, default=10.0, help="Allowed slowdown in percent (default: 10)")
+    parser.add_argument("--filter", default="", help="Checks only the benchmarks matching the regex")
+    args = parser.parse_args()
+
+    pattern = re.compile(args.filter)
+    baseline = throughputs(args.baseline, pattern)
+    current = throughputs(args.current, pattern)
+
+    regressions = 0
+    for name in sorted(baseline):
+        if name not in current:
+            print(f"MISSING  {name}")
+            continue
+        key, base = baseline[name]
+        _, value = current[name]
+        change = 100.0 * (value - base) / base if base else 0.0
+        status = "OK"
+        if change < -args.tolerance:
+            status = "SLOWER"
+            regressions += 1
+        print(f"{status:8} {name}: {value:.4g} {key} ({change:+.1f}%)")
+    if regressions:
+        print(f"{regressions} benchmark(s) regressed by more than {args.tolerance}%", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,80 @@
+
+#include <ChunkStore.hpp>
+#include <Chunker.hpp>
+#include <DigestIndex.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+    const std::vector<uint8_t> &source () {
+        static const std::vector<uint8_t> result = [] () {
+            std::mt19937         rng (1);
+            std::vector<uint8_t> v (64u << 20u);
+            for (auto &x : v) {
+                x = static_cast<uint8_t> (rng ());
+            }
+            return v;
+        }();
+        return result;
+    }
+
+    void BM_Chunker (benchmark::State &state) {
+        auto const    &src = source ();
+        Tiger::Chunker chunker;
+        for (auto _ : state) {
+            size_t cnt = 0;
+            for (size_t off = 0; off < src.size (); ++cnt) {
+                off += chunker.Next (src.data () + off, src.size () - off);
+            }
+            benchmark::DoNotOptimize (cnt);
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations () * src.size ()));
+    }
+
+    /// Looks up the digests in the index of the argument # of entries (half of the lookups miss).
+    void BM_DigestIndexFind (benchmark::State &state) {
+        auto const                   cnt = static_cast<uint32_t> (state.range (0));
+        std::vector<Tiger::digest_t> digests;
+        Tiger::DigestIndex           index (cnt);
+        for (uint32_t i = 0; i < 2 * cnt; ++i) {
+            digests.emplace_back (Tiger::Hash (&i, sizeof (i)));
+            if (i % 2 == 0) {
+                index.Insert (digests.back (), i);
+            }
+        }
+        for (auto _ : state) {
+            size_t found = 0;
+            for (auto const &d : digests) {
+                uint64_t value;
+                found += index.Find (d, value) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize (found);
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations () * digests.size ()));
+    }
+
+    /// Ingests the stream with the argument # of threads.
+    void BM_ChunkStoreIngest (benchmark::State &state) {
+        auto const              &src = source ();
+        Tiger::ChunkStoreOptions options;
+        options.cntThread = static_cast<size_t> (state.range (0));
+
+        std::vector<Tiger::ChunkRef> refs;
+        for (auto _ : state) {
+            Tiger::ChunkStore store (options);
+            refs.clear ();
+            store.Ingest (src.data (), src.size (), true, refs);
+            benchmark::DoNotOptimize (refs.data ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations () * src.size ()));
+    }
+}  // namespace
+
+BENCHMARK (BM_Chunker)->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_DigestIndexFind)->Arg (1 << 10)->Arg (1 << 16)->Arg (1 << 21);
+BENCHMARK (BM_ChunkStoreIngest)->Arg (1)->Arg (2)->Arg (4)->Unit (benchmark::kMillisecond)->UseRealTime ();
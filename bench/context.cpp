@@ -0,0 +1,59 @@
+
+#include <ContextPool.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+    const size_t MESSAGE_SIZE = 100;
+
+    /// Opens the argument # of streams, feeds a message to each and closes them (with heap allocated `Generator`s).
+    void BM_StreamsGenerator (benchmark::State &state) {
+        std::vector<uint8_t> msg (MESSAGE_SIZE, 'a');
+        auto const           cnt = static_cast<size_t> (state.range (0));
+
+        std::vector<std::unique_ptr<Tiger::Generator>> streams (cnt);
+        for (auto _ : state) {
+            for (auto &s : streams) {
+                s.reset (new Tiger::Generator (Tiger::DefaultSBox ()));
+            }
+            for (auto &s : streams) {
+                s->Update (msg.data (), msg.size ());
+            }
+            for (auto &s : streams) {
+                benchmark::DoNotOptimize (s->Finalize ());
+                s.reset ();
+            }
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations () * cnt));
+    }
+
+    /// Same as above with the pooled `Context`s.
+    void BM_StreamsContextPool (benchmark::State &state) {
+        std::vector<uint8_t> msg (MESSAGE_SIZE, 'a');
+        auto const           cnt = static_cast<size_t> (state.range (0));
+
+        Tiger::ContextPool            pool (cnt);
+        std::vector<Tiger::Context *> streams (cnt);
+        for (auto _ : state) {
+            for (auto &s : streams) {
+                s = pool.Acquire ();
+            }
+            for (auto &s : streams) {
+                s->Update (msg.data (), msg.size ());
+            }
+            for (auto &s : streams) {
+                benchmark::DoNotOptimize (s->Finalize ());
+                pool.Release (s);
+            }
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations () * cnt));
+    }
+}  // namespace
+
+BENCHMARK (BM_StreamsGenerator)->Arg (1 << 10)->Arg (1 << 20);
+BENCHMARK (BM_StreamsContextPool)->Arg (1 << 10)->Arg (1 << 20);
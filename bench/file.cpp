@@ -0,0 +1,39 @@
+
+#include <HashFile.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+    const char *const BENCH_FILE = "bench-tiger-hashfile.tmp";
+
+    /// Hashes a file of the given size, mapped (arg 1) or read ahead (arg 0).
+    void BM_HashFile (benchmark::State &state) {
+        {
+            std::vector<uint8_t> src (static_cast<size_t> (state.range (0)), 'a');
+            auto                 fp = std::fopen (BENCH_FILE, "wb");
+            std::fwrite (src.data (), 1, src.size (), fp);
+            std::fclose (fp);
+        }
+        Tiger::HashFileOptions options;
+        options.useMmap = state.range (1) != 0;
+        state.SetLabel (options.useMmap ? "mmap" : "read-ahead");
+
+        double rate = 0.0;
+        for (auto _ : state) {
+            auto const result = Tiger::HashFile (BENCH_FILE, options);
+            benchmark::DoNotOptimize (result.digest);
+            rate = result.BytesPerSecond ();
+        }
+        std::remove (BENCH_FILE);
+        state.counters["reported_bytes_per_second"] = rate;
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * state.range (0));
+    }
+}  // namespace
+
+BENCHMARK (BM_HashFile)->ArgsProduct ({{1 << 20, 256 << 20}, {0, 1}})->Unit (benchmark::kMillisecond);
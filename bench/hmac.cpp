@@ -0,0 +1,63 @@
+
+#include <Hmac.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    const size_t MESSAGES = 1024;
+
+    const uint8_t KEY[] = "0123456789abcdef0123456789abcdef";
+
+    /// HMAC on top of `Generator` (the key blocks are compressed for every MAC).
+    void BM_HmacGenerator (benchmark::State &state) {
+        std::vector<uint8_t> msg (static_cast<size_t> (state.range (0)), 'a');
+        uint8_t              ipad[Tiger::Hmac::BLOCK_SIZE] = {};
+        uint8_t              opad[Tiger::Hmac::BLOCK_SIZE] = {};
+        for (size_t i = 0; i < sizeof (KEY); ++i) {
+            ipad[i] = KEY[i];
+            opad[i] = KEY[i];
+        }
+        for (size_t i = 0; i < Tiger::Hmac::BLOCK_SIZE; ++i) {
+            ipad[i] ^= 0x36u;
+            opad[i] ^= 0x5Cu;
+        }
+        for (auto _ : state) {
+            Tiger::Generator inner (Tiger::DefaultSBox ());
+            auto const       digest = inner.Update (ipad, sizeof (ipad)).Update (msg.data (), msg.size ()).Finalize ();
+            Tiger::Generator outer (Tiger::DefaultSBox ());
+            benchmark::DoNotOptimize (outer.Update (opad, sizeof (opad)).Update (digest.data (), digest.size ()).Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * state.range (0));
+    }
+
+    void BM_Hmac (benchmark::State &state) {
+        std::vector<uint8_t> msg (static_cast<size_t> (state.range (0)), 'a');
+        Tiger::Hmac          hmac (KEY, sizeof (KEY));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (hmac.Mac (msg.data (), msg.size ()));
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * state.range (0));
+    }
+
+    /// MESSAGES messages of the same size under the same key.
+    void BM_HmacBatch (benchmark::State &state) {
+        std::vector<uint8_t>         msg (static_cast<size_t> (state.range (0)), 'a');
+        std::vector<Tiger::ByteView> inputs (MESSAGES, Tiger::ByteView {msg.data (), msg.size ()});
+        std::vector<Tiger::digest_t> result (MESSAGES);
+        Tiger::Hmac                  hmac (KEY, sizeof (KEY));
+        for (auto _ : state) {
+            hmac.Mac (result.data (), inputs.data (), inputs.size ());
+            benchmark::DoNotOptimize (result.data ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * state.range (0) * MESSAGES);
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()) * MESSAGES);
+    }
+}  // namespace
+
+BENCHMARK (BM_HmacGenerator)->Arg (16)->Arg (64)->Arg (1024);
+BENCHMARK (BM_Hmac)->Arg (16)->Arg (64)->Arg (1024);
+BENCHMARK (BM_HmacBatch)->Arg (16)->Arg (64)->Arg (1024);
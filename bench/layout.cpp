@@ -0,0 +1,116 @@
+
+#include <SBoxReplicas.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    const size_t MESSAGE_SIZE = 1024;
+
+    /// Index of the entry IDX of the table TABLE (0..3), table by table or entry by entry.
+    template <bool INTERLEAVED_>
+    size_t sbox_index (size_t table, uint8_t idx) {
+        return INTERLEAVED_ ? 4 * idx + table : 256 * table + idx;
+    }
+
+    /**
+     * The rounds of Tiger (3 passes, without the key schedule) over the message.
+     *
+     * Only the S-box lookups differ between the layouts, so this measures
+     * their locality alone.
+     */
+    template <bool INTERLEAVED_>
+    uint64_t rounds (const Tiger::sbox_t &sbox, const uint64_t *message, size_t count) {
+        uint64_t a = 0x0123456789ABCDEFuLL;
+        uint64_t b = 0xFEDCBA9876543210uLL;
+        uint64_t c = 0xF096A5B4C3B2E187uLL;
+        auto     round = [&sbox] (uint64_t &A, uint64_t &B, uint64_t &C, uint64_t x, uint64_t mul) {
+            C ^= x;
+            auto byte = [&C] (unsigned i) { return static_cast<uint8_t> (C >> (8 * i)); };
+            A -= sbox[sbox_index<INTERLEAVED_> (0, byte (0))] ^ sbox[sbox_index<INTERLEAVED_> (1, byte (2))]
+                 ^ sbox[sbox_index<INTERLEAVED_> (2, byte (4))] ^ sbox[sbox_index<INTERLEAVED_> (3, byte (6))];
+            B += sbox[sbox_index<INTERLEAVED_> (3, byte (1))] ^ sbox[sbox_index<INTERLEAVED_> (2, byte (3))]
+                 ^ sbox[sbox_index<INTERLEAVED_> (1, byte (5))] ^ sbox[sbox_index<INTERLEAVED_> (0, byte (7))];
+            B *= mul;
+        };
+        for (size_t i = 0; i + 8 <= count; i += 8) {
+            for (uint64_t mul : {5, 7, 9}) {
+                round (a, b, c, message[i + 0], mul);
+                round (b, c, a, message[i + 1], mul);
+                round (c, a, b, message[i + 2], mul);
+                round (a, b, c, message[i + 3], mul);
+                round (b, c, a, message[i + 4], mul);
+                round (c, a, b, message[i + 5], mul);
+                round (a, b, c, message[i + 6], mul);
+                round (b, c, a, message[i + 7], mul);
+            }
+        }
+        return a ^ b ^ c;
+    }
+
+    /**
+     * Runs the rounds over 1 KiB messages, evicting the caches between them.
+     *
+     * The interleaved layout (`sbox[4 * index + table]`) is kept here alone:
+     * The 4 lookups of a half round take the different bytes, so they do not
+     * share the lines and it measured slower than the flat one.
+     *
+     * Args: layout (0: flat, 1: interleaved), # of bytes touched between the messages (0: no pressure)
+     */
+    void BM_SBoxLayout (benchmark::State &state) {
+        auto const interleaved = state.range (0) != 0;
+        auto const pressure    = static_cast<size_t> (state.range (1));
+
+        Tiger::sbox_t sbox;
+        auto const   &flat = Tiger::DefaultSBox ();
+        for (size_t table = 0; table < 4; ++table) {
+            for (size_t idx = 0; idx < 256; ++idx) {
+                sbox[interleaved ? 4 * idx + table : 256 * table + idx] = flat[256 * table + idx];
+            }
+        }
+
+        std::vector<uint64_t> src (MESSAGE_SIZE / sizeof (uint64_t), 0x6161616161616161uLL);
+        std::vector<uint64_t> noise (pressure / sizeof (uint64_t) + 1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (interleaved ? rounds<true> (sbox, src.data (), src.size ()) : rounds<false> (sbox, src.data (), src.size ()));
+
+            state.PauseTiming ();
+            for (size_t i = 0; i < noise.size (); i += 8) {
+                ++noise[i];
+            }
+            benchmark::ClobberMemory ();
+            state.ResumeTiming ();
+        }
+        state.SetLabel (interleaved ? "interleaved" : "flat");
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations () * MESSAGE_SIZE));
+    }
+
+    /// Hashes 1 KiB messages with the NUMA-local replica of the SBox, evicting the caches between them (Arg: pressure).
+    void BM_SBoxReplicas (benchmark::State &state) {
+        auto const pressure = static_cast<size_t> (state.range (0));
+
+        Tiger::SBoxReplicas replicas (Tiger::DefaultSBox ());
+
+        std::vector<uint8_t>  src (MESSAGE_SIZE, 'a');
+        std::vector<uint64_t> noise (pressure / sizeof (uint64_t) + 1);
+        for (auto _ : state) {
+            Tiger::Generator gen (replicas.Local ());
+            gen.Update (src.data (), src.size ());
+            benchmark::DoNotOptimize (gen.Finalize ());
+
+            state.PauseTiming ();
+            for (size_t i = 0; i < noise.size (); i += 8) {
+                ++noise[i];
+            }
+            benchmark::ClobberMemory ();
+            state.ResumeTiming ();
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations () * MESSAGE_SIZE));
+    }
+}  // namespace
+
+BENCHMARK (BM_SBoxLayout)->ArgsProduct ({{0, 1}, {0, 256 << 10, 8 << 20}});
+BENCHMARK (BM_SBoxReplicas)->Arg (0)->Arg (256 << 10)->Arg (8 << 20);
@@ -0,0 +1,115 @@
+
+#include <HashBatch.hpp>
+#include <Kernel.hpp>
+#include <MultiGenerator.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+    const size_t RECORDS = 1024;
+
+    /** Records of 100..4000 bytes (dedup keys).  */
+    struct Records {
+        std::vector<std::vector<uint8_t>> messages;
+        std::vector<const void *>         data;
+        std::vector<size_t>               sizes;
+        int64_t                           total = 0;
+
+        Records () {
+            std::mt19937 rng (1);
+            for (size_t i = 0; i < RECORDS; ++i) {
+                messages.emplace_back (100 + rng () % 3900, static_cast<uint8_t> (i));
+                data.emplace_back (messages.back ().data ());
+                sizes.emplace_back (messages.back ().size ());
+                total += static_cast<int64_t> (messages.back ().size ());
+            }
+        }
+    };
+
+    const Records &records () {
+        static const Records result;
+        return result;
+    }
+
+    void BM_RecordsGenerator (benchmark::State &state) {
+        auto const &src = records ();
+
+        std::vector<Tiger::digest_t> result (RECORDS);
+        for (auto _ : state) {
+            for (size_t i = 0; i < RECORDS; ++i) {
+                Tiger::Generator gen (Tiger::DefaultSBox ());
+                gen.Update (src.data[i], src.sizes[i]);
+                result[i] = gen.Finalize ();
+            }
+            benchmark::DoNotOptimize (result.data ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * src.total);
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()) * RECORDS);
+    }
+
+    template <size_t N_>
+    void BM_RecordsMultiGenerator (benchmark::State &state) {
+        auto const &src = records ();
+
+        std::vector<Tiger::digest_t> result (RECORDS);
+        Tiger::MultiGenerator<N_>    multi (Tiger::DefaultSBox ());
+        for (auto _ : state) {
+            multi.Hash (result.data (), src.data.data (), src.sizes.data (), RECORDS);
+            benchmark::DoNotOptimize (result.data ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * src.total);
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()) * RECORDS);
+    }
+
+    /// Same as above with the kernel pinned by the argument.
+    template <size_t N_>
+    void BM_RecordsKernel (benchmark::State &state) {
+        auto const kernel = static_cast<Tiger::Kernel> (state.range (0));
+        if (! Tiger::SelectKernel (kernel)) {
+            state.SkipWithError ("Kernel is not available");
+            return;
+        }
+        state.SetLabel (Tiger::KernelName (kernel));
+        BM_RecordsMultiGenerator<N_> (state);
+        Tiger::SelectKernel (Tiger::Kernel::Auto);
+    }
+
+    /// `HashBatch` with the # of threads given by the argument.
+    void BM_RecordsHashBatch (benchmark::State &state) {
+        auto const &src = records ();
+
+        std::vector<Tiger::ByteView> inputs;
+        for (size_t i = 0; i < RECORDS; ++i) {
+            inputs.push_back (Tiger::ByteView {src.data[i], src.sizes[i]});
+        }
+        Tiger::HashBatchOptions options;
+        options.cntThread = static_cast<size_t> (state.range (0));
+
+        std::vector<Tiger::digest_t> result (RECORDS);
+        for (auto _ : state) {
+            Tiger::HashBatch (result.data (), inputs.data (), RECORDS, options);
+            benchmark::DoNotOptimize (result.data ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * src.total);
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()) * RECORDS);
+    }
+
+    void KernelArgs (benchmark::internal::Benchmark *b) {
+        for (auto kernel : {Tiger::Kernel::Portable, Tiger::Kernel::SSE42, Tiger::Kernel::AVX2, Tiger::Kernel::AVX512}) {
+            b->Arg (static_cast<int64_t> (kernel));
+        }
+    }
+}  // namespace
+
+BENCHMARK (BM_RecordsGenerator);
+BENCHMARK_TEMPLATE (BM_RecordsMultiGenerator, 2);
+BENCHMARK_TEMPLATE (BM_RecordsMultiGenerator, 4);
+BENCHMARK_TEMPLATE (BM_RecordsMultiGenerator, 8);
+BENCHMARK (BM_RecordsHashBatch)->Arg (1)->Arg (2)->Arg (4)->UseRealTime ();
+BENCHMARK_TEMPLATE (BM_RecordsKernel, 4)->Apply (KernelArgs);
+BENCHMARK_TEMPLATE (BM_RecordsKernel, 8)->Apply (KernelArgs);
@@ -0,0 +1,36 @@
+
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    /// Latency of `Tiger::Hash` (ns/call) by the message size.
+    void BM_HashLatency (benchmark::State &state) {
+        auto const           size = static_cast<size_t> (state.range (0));
+        std::vector<uint8_t> src (size, 'k');
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (Tiger::Hash (src.data (), size));
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()));
+    }
+
+    /// Same as above with `Generator` (for comparison).
+    void BM_GeneratorLatency (benchmark::State &state) {
+        auto const           size = static_cast<size_t> (state.range (0));
+        std::vector<uint8_t> src (size, 'k');
+
+        for (auto _ : state) {
+            Tiger::Generator gen (Tiger::DefaultSBox ());
+            gen.Update (src.data (), size);
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()));
+    }
+}  // namespace
+
+BENCHMARK (BM_HashLatency)->DenseRange (0, 128, 8);
+BENCHMARK (BM_GeneratorLatency)->DenseRange (0, 128, 8);
@@ -0,0 +1,41 @@
+
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    const size_t MESSAGE_SIZE = 64 * 1024;
+
+    /// Runtime pass count: 3/4/6/8 dispatch to the unrolled functions, others run the generic loop.
+    void BM_GeneratorPasses (benchmark::State &state) {
+        std::vector<uint8_t> src (MESSAGE_SIZE, 'a');
+
+        for (auto _ : state) {
+            Tiger::Generator gen (Tiger::DefaultSBox (), static_cast<size_t> (state.range (0)));
+            gen.Update (src.data (), src.size ());
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * static_cast<int64_t> (src.size ()));
+    }
+
+    template <size_t PASSES_>
+    void BM_BasicGenerator (benchmark::State &state) {
+        std::vector<uint8_t> src (MESSAGE_SIZE, 'a');
+
+        for (auto _ : state) {
+            Tiger::BasicGenerator<PASSES_> gen (Tiger::DefaultSBox ());
+            gen.Update (src.data (), src.size ());
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * static_cast<int64_t> (src.size ()));
+    }
+}  // namespace
+
+BENCHMARK (BM_GeneratorPasses)->DenseRange (3, 8);
+BENCHMARK_TEMPLATE (BM_BasicGenerator, 3);
+BENCHMARK_TEMPLATE (BM_BasicGenerator, 4);
+BENCHMARK_TEMPLATE (BM_BasicGenerator, 6);
+BENCHMARK_TEMPLATE (BM_BasicGenerator, 8);
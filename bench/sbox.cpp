@@ -0,0 +1,79 @@
+
+#include <SBoxCache.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+    /// The default S-box computed at runtime.
+    void BM_InitializeSBox (benchmark::State &state) {
+        Tiger::sbox_t sbox;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (Tiger::InitializeSBox (sbox));
+        }
+    }
+
+    /// A seeded S-box with the # of passes given by the argument.
+    void BM_InitializeSBoxSeeded (benchmark::State &state) {
+        const char    seed[] = "tenant-0001";
+        Tiger::sbox_t sbox;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (Tiger::InitializeSBox (sbox, seed, sizeof (seed), static_cast<size_t> (state.range (0))));
+        }
+    }
+
+    /// The precomputed default S-box (a copy, to compare with the above).
+    void BM_DefaultSBox (benchmark::State &state) {
+        Tiger::sbox_t sbox;
+        for (auto _ : state) {
+            sbox = Tiger::DefaultSBox ();
+            benchmark::DoNotOptimize (sbox);
+        }
+    }
+
+    /// 64 tenants (5 passes) with the # of threads given by the argument.
+    void BM_BuildSBoxes (benchmark::State &state) {
+        std::vector<std::string>     seeds;
+        std::vector<Tiger::ByteView> views;
+        for (size_t i = 0; i < 64; ++i) {
+            seeds.emplace_back ("tenant-" + std::to_string (i));
+        }
+        for (auto const &s : seeds) {
+            views.emplace_back (Tiger::ByteView {s.data (), s.size ()});
+        }
+        std::vector<Tiger::sbox_t> result (seeds.size ());
+        for (auto _ : state) {
+            Tiger::BuildSBoxes (result.data (), views.data (), views.size (), 5, static_cast<size_t> (state.range (0)));
+            benchmark::DoNotOptimize (result.data ());
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations () * seeds.size ()));
+    }
+
+    /// Loading a cached SBox (by a fresh cache, as in a restart).
+    void BM_SBoxCacheHit (benchmark::State &state) {
+        const char  seed[] = "tenant-0001";
+        std::string path;
+        {
+            Tiger::SBoxCache cache ("bench-tiger-sboxcache.tmp");
+            path = cache.PathOf (seed, sizeof (seed), 5);
+            cache.Get (seed, sizeof (seed), 5);
+        }
+        for (auto _ : state) {
+            Tiger::SBoxCache cache ("bench-tiger-sboxcache.tmp");
+            benchmark::DoNotOptimize (cache.Get (seed, sizeof (seed), 5)[0]);
+        }
+        std::remove (path.c_str ());
+        std::remove ("bench-tiger-sboxcache.tmp");
+    }
+}  // namespace
+
+BENCHMARK (BM_InitializeSBox)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_InitializeSBoxSeeded)->Arg (1)->Arg (5)->Arg (10)->Unit (benchmark::kMicrosecond);
+BENCHMARK (BM_DefaultSBox);
+BENCHMARK (BM_BuildSBoxes)->Arg (1)->Arg (2)->Arg (4)->UseRealTime ()->Unit (benchmark::kMillisecond);
+BENCHMARK (BM_SBoxCacheHit)->Unit (benchmark::kMicrosecond);
@@ -0,0 +1,75 @@
+
+#include <StreamHasher.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+    const size_t STREAM_SIZE = 64u << 20u;
+    const size_t READ_SIZE   = 1u << 20u;
+
+    /// Reads the STREAM_SIZE bytes taking the argument (in us) per read (models the device latency).
+    class SlowReader {
+        std::vector<uint8_t>      chunk_;
+        std::chrono::microseconds latency_;
+        size_t                    remaining_ = STREAM_SIZE;
+
+    public:
+        explicit SlowReader (int64_t latency) : chunk_ (READ_SIZE, 'a'), latency_ {latency} { /* NO-OP */
+        }
+
+        ptrdiff_t operator() (uint8_t *buffer, size_t size) {
+            size_t n = std::min ({size, chunk_.size (), remaining_});
+            if (0 < n) {
+                std::this_thread::sleep_for (latency_);
+                std::memcpy (buffer, chunk_.data (), n);
+                remaining_ -= n;
+            }
+            return static_cast<ptrdiff_t> (n);
+        }
+    };
+
+    /// Reads and compresses alternately.
+    void BM_StreamSerial (benchmark::State &state) {
+        std::vector<uint8_t> buffer (READ_SIZE);
+        for (auto _ : state) {
+            SlowReader       reader (state.range (0));
+            Tiger::Generator gen (Tiger::DefaultSBox ());
+            while (auto n = reader (buffer.data (), buffer.size ())) {
+                gen.Update (buffer.data (), static_cast<size_t> (n));
+            }
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * STREAM_SIZE);
+    }
+
+    /// Reads and compresses in the overlapped stages.
+    void BM_StreamHasher (benchmark::State &state) {
+        Tiger::StreamHasherOptions options;
+        options.bufferSize = READ_SIZE;
+
+        double producerStall = 0.0;
+        double hasherStall   = 0.0;
+        for (auto _ : state) {
+            Tiger::StreamHasher hasher (options);
+            hasher.Pump (SlowReader (state.range (0)));
+            auto const result = hasher.Finalize ().get ();
+            benchmark::DoNotOptimize (result.digest);
+            producerStall += result.producerStall;
+            hasherStall += result.hasherStall;
+        }
+        state.counters["producer_stall"] = benchmark::Counter (producerStall, benchmark::Counter::kAvgIterations);
+        state.counters["hasher_stall"]   = benchmark::Counter (hasherStall, benchmark::Counter::kAvgIterations);
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * STREAM_SIZE);
+    }
+}  // namespace
+
+BENCHMARK (BM_StreamSerial)->Arg (0)->Arg (500)->Arg (2000)->Unit (benchmark::kMillisecond)->UseRealTime ();
+BENCHMARK (BM_StreamHasher)->Arg (0)->Arg (500)->Arg (2000)->Unit (benchmark::kMillisecond)->UseRealTime ();
@@ -0,0 +1,75 @@
+#include <TableHash.hpp>
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    /// The full digest truncated to 64 bits (the baseline).
+    void BM_TableHashDigest (benchmark::State &state) {
+        std::vector<uint8_t> key (static_cast<size_t> (state.range (0)), 'a');
+        for (auto _ : state) {
+            auto const digest = Tiger::Hash (key.data (), key.size ());
+            uint64_t   h;
+            ::memcpy (&h, digest.data (), sizeof (h));
+            benchmark::DoNotOptimize (h);
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()));
+    }
+
+    void BM_TableHash (benchmark::State &state) {
+        std::vector<uint8_t> key (static_cast<size_t> (state.range (0)), 'a');
+        Tiger::TableHash     hash;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (hash (key.data (), key.size ()));
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()));
+    }
+
+    void BM_TableHashInteger (benchmark::State &state) {
+        Tiger::TableHash hash;
+        uint64_t         v = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (hash (v++));
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()));
+    }
+
+    const size_t ENTRIES = 100000;
+
+    std::vector<std::string> make_keys () {
+        std::vector<std::string> result;
+        for (size_t i = 0; i < ENTRIES; ++i) {
+            result.emplace_back ("user:" + std::to_string (i * 7919));
+        }
+        return result;
+    }
+
+    /// Looking up the string keys in `std::unordered_map` with the HASHER_.
+    template <typename Hasher_>
+    void BM_TableLookup (benchmark::State &state) {
+        auto const                                         keys = make_keys ();
+        std::unordered_map<std::string, size_t, Hasher_> map;
+        for (size_t i = 0; i < keys.size (); ++i) {
+            map.emplace (keys[i], i);
+        }
+        size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize (map.find (keys[i]));
+            i = (i + 1) % keys.size ();
+        }
+        state.SetItemsProcessed (static_cast<int64_t> (state.iterations ()));
+    }
+}  // namespace
+
+BENCHMARK (BM_TableHashDigest)->Arg (8)->Arg (24)->Arg (64)->Arg (256);
+BENCHMARK (BM_TableHash)->Arg (8)->Arg (24)->Arg (64)->Arg (256);
+BENCHMARK (BM_TableHashInteger);
+BENCHMARK_TEMPLATE (BM_TableLookup, std::hash<std::string>);
+BENCHMARK_TEMPLATE (BM_TableLookup, Tiger::TableHasher);
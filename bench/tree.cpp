@@ -0,0 +1,35 @@
+
+#include <Tiger.hpp>
+#include <TreeHasher.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+    /// Tree hash of a 64 MiB message with the # of threads given by the argument.
+    void BM_TreeHasher (benchmark::State &state) {
+        std::vector<uint8_t> src (64u << 20, 'a');
+        Tiger::TreeHasher    tree (Tiger::DefaultSBox (), static_cast<size_t> (state.range (0)), Tiger::TreeHasher::NO_LEVELS);
+
+        for (auto _ : state) {
+            tree.Reset ();
+            tree.Update (src.data (), src.size ());
+            benchmark::DoNotOptimize (tree.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * static_cast<int64_t> (src.size ()));
+    }
+
+    void ThreadArgs (benchmark::internal::Benchmark *b) {
+        auto const cntMax = std::max<int64_t> (1, std::thread::hardware_concurrency ());
+        for (int64_t n = 1; n < cntMax; n *= 2) {
+            b->Arg (n);
+        }
+        b->Arg (cntMax);
+    }
+}  // namespace
+
+BENCHMARK (BM_TreeHasher)->Apply (ThreadArgs)->UseRealTime ()->Unit (benchmark::kMillisecond);
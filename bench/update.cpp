@@ -0,0 +1,97 @@
+
+#include <Tiger.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+    /// A message shared among the benchmarks (grown on demand).
+    const uint8_t *message (size_t size) {
+        static std::vector<uint8_t> src;
+        if (src.size () < size) {
+            src.assign (size, 'a');
+        }
+        return src.data ();
+    }
+
+    /// Throughput vs. message size.  Args: size, Tiger2
+    void BM_Throughput (benchmark::State &state) {
+        auto const size     = static_cast<size_t> (state.range (0));
+        auto const isTiger2 = state.range (1) != 0;
+        auto const src      = message (size);
+
+        state.SetLabel (isTiger2 ? "Tiger2" : "Tiger");
+        for (auto _ : state) {
+            Tiger::Generator gen (Tiger::DefaultSBox (), Tiger::DEFAULT_PASSES, isTiger2);
+            gen.Update (src, size);
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * state.range (0));
+    }
+
+    /// `Update` call granularity.  Args: size, bytes per `Update` call
+    void BM_UpdateGranularity (benchmark::State &state) {
+        auto const size  = static_cast<size_t> (state.range (0));
+        auto const chunk = static_cast<size_t> (state.range (1));
+        auto const src   = message (size);
+
+        for (auto _ : state) {
+            Tiger::Generator gen (Tiger::DefaultSBox ());
+            for (size_t off = 0; off < size; off += chunk) {
+                gen.Update (src + off, std::min (chunk, size - off));
+            }
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * state.range (0));
+    }
+
+    /// Feeds the message byte by byte with `Update (uint8_t)`.
+    void BM_UpdatePerByte (benchmark::State &state) {
+        auto const size = static_cast<size_t> (state.range (0));
+        auto const src  = message (size);
+
+        for (auto _ : state) {
+            Tiger::Generator gen (Tiger::DefaultSBox ());
+            for (size_t i = 0; i < size; ++i) {
+                gen.Update (src[i]);
+            }
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations ()) * state.range (0));
+    }
+
+    /// Scattered input (1 MiB in segments of the argument size) with a single `UpdateV` call.
+    void BM_UpdateSegments (benchmark::State &state) {
+        size_t const size    = 1 << 20;
+        auto const   segment = static_cast<size_t> (state.range (0));
+        auto const   src     = message (size);
+
+        std::vector<Tiger::ByteView> segments;
+        for (size_t off = 0; off < size; off += segment) {
+            segments.emplace_back (Tiger::ByteView {src + off, std::min (segment, size - off)});
+        }
+        for (auto _ : state) {
+            Tiger::Generator gen (Tiger::DefaultSBox ());
+            gen.UpdateV (segments.data (), segments.size ());
+            benchmark::DoNotOptimize (gen.Finalize ());
+        }
+        state.SetBytesProcessed (static_cast<int64_t> (state.iterations () * size));
+    }
+
+    void ThroughputArgs (benchmark::internal::Benchmark *b) {
+        for (int64_t isTiger2 : {0, 1}) {
+            b->Args ({0, isTiger2});
+            for (int64_t size = 1; size <= (1 << 30); size *= 16) {
+                b->Args ({size, isTiger2});
+            }
+            b->Args ({1 << 30, isTiger2});
+        }
+    }
+}  // namespace
+
+BENCHMARK (BM_Throughput)->Apply (ThroughputArgs);
+BENCHMARK (BM_UpdateGranularity)->ArgsProduct ({{1 << 20}, {1, 7, 64, 100, 4096, 1 << 20}});
+BENCHMARK (BM_UpdateSegments)->Arg (100)->Arg (1448)->Arg (4096);
+BENCHMARK (BM_UpdatePerByte)->Arg (1 << 20);
@@ -0,0 +1,33 @@
+#
+# Installs the libraries and the CMake package for the downstreams:
+#
+#   find_package (tiger 1 REQUIRED)
+#   target_link_libraries (app PRIVATE tiger::tiger)   # The static library (C++ and C)
+#   target_link_libraries (app PRIVATE tiger::shared)  # The shared library (C alone, see tiger.h)
+#
+# The libraries are installed as built (with ENABLE_LTO and PGO_MODE): The
+# package records them in tiger_ENABLE_LTO and tiger_PGO_MODE.
+#
+
+include (GNUInstallDirs)
+include (CMakePackageConfigHelpers)
+
+set (config_dir_ ${CMAKE_INSTALL_LIBDIR}/cmake/${PROJECT_NAME})
+
+install (TARGETS ${libraries_}
+         EXPORT ${PROJECT_NAME}-targets
+         ARCHIVE DESTINATION ${CMAKE_INSTALL_LIBDIR}
+         LIBRARY DESTINATION ${CMAKE_INSTALL_LIBDIR}
+         RUNTIME DESTINATION ${CMAKE_INSTALL_BINDIR})
+install (EXPORT ${PROJECT_NAME}-targets
+         NAMESPACE ${PROJECT_NAME}::
+         DESTINATION ${config_dir_})
+
+configure_package_config_file (${CMAKE_CURRENT_LIST_DIR}/Config.cmake.in
+                               ${CMAKE_BINARY_DIR}/${PROJECT_NAME}-config.cmake
+                               INSTALL_DESTINATION ${config_dir_})
+write_basic_package_version_file (${CMAKE_BINARY_DIR}/${PROJECT_NAME}-config-version.cmake
+                                  COMPATIBILITY SameMajorVersion)
+install (FILES ${CMAKE_BINARY_DIR}/${PROJECT_NAME}-config.cmake
+               ${CMAKE_BINARY_DIR}/${PROJECT_NAME}-config-version.cmake
+         DESTINATION ${config_dir_})
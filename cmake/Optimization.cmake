@@ -0,0 +1,54 @@
+#
+# The link time and the profile guided optimizations of the libraries
+# (ENABLE_LTO, PGO_MODE and PGO_PROFILE_DIR).
+#
+
+if (ENABLE_LTO)
+    include (CheckIPOSupported)
+    check_ipo_supported (RESULT lto_supported_ OUTPUT lto_output_ LANGUAGES CXX)
+    if (NOT lto_supported_)
+        message (WARNING "ENABLE_LTO: Not supported by the toolchain (${lto_output_})")
+    endif ()
+endif ()
+
+if (PGO_MODE AND NOT PGO_MODE MATCHES "^(GENERATE|USE)$")
+    message (FATAL_ERROR "PGO_MODE: Should be GENERATE, USE or empty (not ${PGO_MODE})")
+endif ()
+if (PGO_MODE AND NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+    message (FATAL_ERROR "PGO_MODE: Requires GCC or Clang")
+endif ()
+
+# Applies the optimizations to the OBJECTS_ (compiled) and the LIBRARIES_ (linked from them).
+function (tiger_optimize objects_)
+    set (libraries_ ${ARGN})
+    if (ENABLE_LTO AND lto_supported_)
+        set_target_properties (${objects_} ${libraries_} PROPERTIES INTERPROCEDURAL_OPTIMIZATION ON)
+    endif ()
+
+    if (PGO_MODE STREQUAL "GENERATE")
+        set (flags_ -fprofile-generate=${PGO_PROFILE_DIR})
+        if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            # The batches and the stream hasher update the counters from the threads.
+            list (APPEND flags_ -fprofile-update=prefer-atomic)
+        endif ()
+        target_compile_options (${objects_} PRIVATE ${flags_})
+        foreach (library_ IN LISTS libraries_)
+            # Whatever links the instrumented code needs the profiling runtime.
+            target_link_options (${library_} PUBLIC $<BUILD_INTERFACE:-fprofile-generate=${PGO_PROFILE_DIR}>)
+        endforeach ()
+    elseif (PGO_MODE STREQUAL "USE")
+        if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+            # Looks up the profiles by the object paths: Reuse the build tree of GENERATE.
+            set (flags_ -fprofile-use=${PGO_PROFILE_DIR} -fprofile-correction -Wno-missing-profile)
+        else ()
+            # Merged from the raw profiles by `llvm-profdata merge`.
+            set (flags_ -fprofile-use=${PGO_PROFILE_DIR}/default.profdata -Wno-profile-instr-unprofiled)
+        endif ()
+        target_compile_options (${objects_} PRIVATE ${flags_})
+        if (ENABLE_LTO AND lto_supported_)
+            foreach (library_ IN LISTS libraries_)
+                target_link_options (${library_} PRIVATE ${flags_})
+            endforeach ()
+        endif ()
+    endif ()
+endfunction ()
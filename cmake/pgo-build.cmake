@@ -0,0 +1,61 @@
+#
+# Builds the libraries with the link time and the profile guided optimizations.
+#
+#   cmake -DBINARY_DIR=build-pgo [-DINSTALL_PREFIX=/opt/tiger] [-DCONFIGURE_ARGS="-DFOO=BAR;..."] -P cmake/pgo-build.cmake
+#
+# The stages share BINARY_DIR (GCC looks the profiles up by the object paths):
+#   1. Builds the instrumented libraries and `bench-tiger` (PGO_MODE=GENERATE)
+#   2. Trains them on the benchmark workloads (the `pgo-train` target)
+#   3. Rebuilds the libraries with the profiles (PGO_MODE=USE) and installs them
+#
+# Prepare BINARY_DIR as usual first (e.g. `conan install` for the dependencies).
+#
+
+cmake_minimum_required (VERSION 3.14)
+
+if (NOT BINARY_DIR)
+    message (FATAL_ERROR "Specify the build tree by -DBINARY_DIR=...")
+endif ()
+get_filename_component (source_dir_ "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+get_filename_component (binary_dir_ "${BINARY_DIR}" ABSOLUTE)
+set (profile_dir_ "${binary_dir_}/pgo")
+
+function (run_)
+    string (REPLACE ";" " " command_ "${ARGN}")
+    message (STATUS "pgo-build: ${command_}")
+    execute_process (COMMAND ${ARGN} RESULT_VARIABLE result_)
+    if (NOT result_ EQUAL 0)
+        message (FATAL_ERROR "pgo-build: Failed (${result_})")
+    endif ()
+endfunction ()
+
+function (configure_ mode_)
+    run_ (${CMAKE_COMMAND} -S ${source_dir_} -B ${binary_dir_}
+          -DCMAKE_BUILD_TYPE=Release
+          -DBUILD_BENCHMARKS=ON
+          -DENABLE_LTO=ON
+          -DPGO_MODE=${mode_}
+          -DPGO_PROFILE_DIR=${profile_dir_}
+          ${CONFIGURE_ARGS})
+endfunction ()
+
+file (REMOVE_RECURSE ${profile_dir_})
+
+configure_ (GENERATE)
+run_ (${CMAKE_COMMAND} --build ${binary_dir_} --target pgo-train)
+
+# Clang writes the raw profiles to be merged.
+file (GLOB raw_profiles_ ${profile_dir_}/*.profraw)
+if (raw_profiles_)
+    find_program (LLVM_PROFDATA NAMES llvm-profdata)
+    if (NOT LLVM_PROFDATA)
+        message (FATAL_ERROR "pgo-build: llvm-profdata is not found")
+    endif ()
+    run_ (${LLVM_PROFDATA} merge -o ${profile_dir_}/default.profdata ${raw_profiles_})
+endif ()
+
+configure_ (USE)
+run_ (${CMAKE_COMMAND} --build ${binary_dir_})
+if (INSTALL_PREFIX)
+    run_ (${CMAKE_COMMAND} --install ${binary_dir_} --prefix ${INSTALL_PREFIX})
+endif ()
@@ -0,0 +1,20 @@
+#
+# Cross builds for the big-endian powerpc64 Linux.
+#
+# Tests run under the user-mode emulation:
+#   cmake -S . -B build-powerpc64 -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/powerpc64-linux-gnu.cmake
+#   cmake --build build-powerpc64 && ctest --test-dir build-powerpc64
+#
+
+set (CMAKE_SYSTEM_NAME Linux)
+set (CMAKE_SYSTEM_PROCESSOR powerpc64)
+
+set (CMAKE_C_COMPILER powerpc64-linux-gnu-gcc)
+set (CMAKE_CXX_COMPILER powerpc64-linux-gnu-g++)
+
+set (CMAKE_FIND_ROOT_PATH /usr/powerpc64-linux-gnu)
+set (CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set (CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set (CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+set (CMAKE_CROSSCOMPILING_EMULATOR qemu-ppc64 -L /usr/powerpc64-linux-gnu)
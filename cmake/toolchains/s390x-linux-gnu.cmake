@@ -0,0 +1,20 @@
+#
+# Cross builds for the big-endian s390x Linux.
+#
+# Tests run under the user-mode emulation:
+#   cmake -S . -B build-s390x -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/s390x-linux-gnu.cmake
+#   cmake --build build-s390x && ctest --test-dir build-s390x
+#
+
+set (CMAKE_SYSTEM_NAME Linux)
+set (CMAKE_SYSTEM_PROCESSOR s390x)
+
+set (CMAKE_C_COMPILER s390x-linux-gnu-gcc)
+set (CMAKE_CXX_COMPILER s390x-linux-gnu-g++)
+
+set (CMAKE_FIND_ROOT_PATH /usr/s390x-linux-gnu)
+set (CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set (CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set (CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+set (CMAKE_CROSSCOMPILING_EMULATOR qemu-s390x -L /usr/s390x-linux-gnu)
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Differential.hpp"
+
+#include "Reference.hpp"
+
+#include <HashBatch.hpp>
+#include <Kernel.hpp>
+#include <MultiGenerator.hpp>
+#include <Tiger.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace TigerFuzz {
+    namespace {
+        const size_t HEADER_SIZE = 5;
+
+        /// Messages longer than this are not fed byte by byte.
+        const size_t MAX_BYTEWISE = 4096;
+
+        /// # of messages in the batches (prefixes of the message).
+        const size_t BATCH_SIZE = 9;
+
+        /// The seeded SBoxes (built on demand).
+        const Tiger::sbox_t &seeded_sbox (uint8_t seed) {
+            static std::unique_ptr<Tiger::sbox_t> cache[256];
+            auto                                 &p = cache[seed];
+            if (! p) {
+                p.reset (new Tiger::sbox_t);
+                Tiger::InitializeSBox (*p, &seed, sizeof (seed), 1);
+            }
+            return *p;
+        }
+
+        /// Cuts SIZE bytes into the random pieces (biased to the block boundaries).
+        std::vector<size_t> random_splits (size_t size, uint32_t seed) {
+            std::minstd_rand    rng (seed + 1);
+            std::vector<size_t> result;
+            while (0 < size) {
+                size_t n;
+                switch (rng () % 4) {
+                case 0: n = rng () % 8; break;
+                case 1: n = 64 * (1 + rng () % 4) + (rng () % 3) - 1; break;
+                case 2: n = rng () % 200; break;
+                default: n = rng () % 5000; break;
+                }
+                n = std::min (n, size);
+                result.emplace_back (n);
+                size -= n;
+            }
+            return result;
+        }
+
+        template <size_t PASSES_, Tiger::Padding PADDING_>
+        Tiger::digest_t basic_generator (const Tiger::sbox_t &sbox, const uint8_t *data, const std::vector<size_t> &splits) {
+            Tiger::BasicGenerator<PASSES_, PADDING_> gen (sbox);
+            for (auto n : splits) {
+                gen.Update (data, n);
+                data += n;
+            }
+            return gen.Finalize ();
+        }
+
+        template <Tiger::Padding PADDING_>
+        bool basic_generator (Tiger::digest_t &result, size_t passes, const Tiger::sbox_t &sbox, const uint8_t *data, const std::vector<size_t> &splits) {
+            switch (passes) {
+            case 3: result = basic_generator<3, PADDING_> (sbox, data, splits); return true;
+            case 4: result = basic_generator<4, PADDING_> (sbox, data, splits); return true;
+            case 6: result = basic_generator<6, PADDING_> (sbox, data, splits); return true;
+            case 8: result = basic_generator<8, PADDING_> (sbox, data, splits); return true;
+            default: return false;
+            }
+        }
+
+        template <size_t N_>
+        std::vector<Tiger::digest_t> multi_generator (const Tiger::sbox_t &sbox, size_t passes, bool isTiger2, const std::vector<const void *> &data, const std::vector<size_t> &sizes) {
+            std::vector<Tiger::digest_t> result (data.size ());
+            Tiger::MultiGenerator<N_> (sbox, passes, isTiger2).Hash (result.data (), data.data (), sizes.data (), data.size ());
+            return result;
+        }
+    }  // namespace
+
+    std::vector<std::string> Check (const uint8_t *data, size_t size) {
+        uint8_t header[HEADER_SIZE] = {};
+        std::copy (data, data + std::min (size, HEADER_SIZE), header);
+
+        auto const  passes   = static_cast<size_t> (3 + header[0] % 6);
+        auto const  isTiger2 = (header[1] & 1u) != 0;
+        auto const &sbox     = (header[1] & 2u) != 0 ? seeded_sbox (header[2]) : Tiger::DefaultSBox ();
+        auto const  seed     = static_cast<uint32_t> (header[3] | (header[4] << 8u));
+        auto const *msg      = data + std::min (size, HEADER_SIZE);
+        auto const  cnt      = size - std::min (size, HEADER_SIZE);
+        auto const  splits   = random_splits (cnt, seed);
+        auto const  padding  = isTiger2 ? Tiger::Padding::Tiger2 : Tiger::Padding::Tiger1;
+
+        auto const expected = ReferenceHash (sbox, msg, cnt, passes, isTiger2);
+
+        std::vector<std::string> result;
+        auto check = [&result, &expected] (const std::string &name, const Tiger::digest_t &actual) {
+            if (actual != expected) {
+                result.emplace_back (name);
+            }
+        };
+
+        check ("Generator", Tiger::Generator (sbox, passes, isTiger2).Update (msg, cnt).Finalize ());
+        {
+            Tiger::Generator gen (sbox, passes, isTiger2);
+            auto             p = msg;
+            for (auto n : splits) {
+                gen.Update (p, n);
+                p += n;
+            }
+            check ("Generator (split)", gen.Finalize ());
+        }
+        if (cnt <= MAX_BYTEWISE) {
+            Tiger::Generator gen (sbox, passes, isTiger2);
+            for (size_t i = 0; i < cnt; ++i) {
+                gen.Update (msg[i]);
+            }
+            check ("Generator (byte by byte)", gen.Finalize ());
+        }
+        {
+            std::vector<Tiger::ByteView> segments;
+            auto                         p = msg;
+            for (auto n : splits) {
+                segments.push_back (Tiger::ByteView {p, n});
+                p += n;
+            }
+            Tiger::Generator gen (sbox, passes, isTiger2);
+            check ("Generator (scattered)", gen.UpdateV (segments.data (), segments.size ()).Finalize ());
+        }
+        {
+            auto const       half = splits.empty () ? 0 : splits[0];
+            Tiger::Generator gen (sbox, passes, isTiger2);
+            gen.Update (msg, half);
+            if (gen.Peek () != ReferenceHash (sbox, msg, half, passes, isTiger2)) {
+                result.emplace_back ("Generator::Peek");
+            }
+            Tiger::Generator resumed (sbox);
+            if (! resumed.RestoreState (gen.SaveState ())) {
+                result.emplace_back ("Generator::RestoreState");
+            }
+            check ("Generator (resumed)", resumed.Update (msg + half, cnt - half).Finalize ());
+        }
+        {
+            Tiger::digest_t digest;
+            if (isTiger2 ? basic_generator<Tiger::Padding::Tiger2> (digest, passes, sbox, msg, splits)
+                         : basic_generator<Tiger::Padding::Tiger1> (digest, passes, sbox, msg, splits)) {
+                check ("BasicGenerator", digest);
+            }
+        }
+        if (passes == Tiger::DEFAULT_PASSES) {
+            check ("Hash", isTiger2 ? Tiger::Hash2 (sbox, msg, cnt) : Tiger::Hash (sbox, msg, cnt));
+        }
+        {
+            Tiger::Context ctx;
+            ctx.Reset (passes, padding);
+            auto p = msg;
+            for (auto n : splits) {
+                ctx.Update (sbox, p, n);
+                p += n;
+            }
+            check ("Context", ctx.Finalize (sbox));
+        }
+
+        // The batches of the prefixes (the lanes run out at the different blocks).
+        std::vector<const void *>     batch;
+        std::vector<size_t>           sizes;
+        std::vector<Tiger::ByteView>  views;
+        std::vector<Tiger::digest_t>  expectedBatch;
+        for (size_t i = 0; i < BATCH_SIZE; ++i) {
+            auto const n = cnt - cnt * i / (BATCH_SIZE - 1) / (i + 1);
+            batch.emplace_back (msg);
+            sizes.emplace_back (n);
+            views.push_back (Tiger::ByteView {msg, n});
+            expectedBatch.emplace_back (ReferenceHash (sbox, msg, n, passes, isTiger2));
+        }
+        auto checkBatch = [&result, &expectedBatch] (const std::string &name, const std::vector<Tiger::digest_t> &actual) {
+            if (actual != expectedBatch) {
+                result.emplace_back (name);
+            }
+        };
+        {
+            std::vector<Tiger::digest_t> digests (BATCH_SIZE);
+            Tiger::HashBatchOptions      options;
+            options.sbox    = &sbox;
+            options.passes  = passes;
+            options.padding = padding;
+            Tiger::HashBatch (digests.data (), views.data (), views.size (), options);
+            checkBatch ("HashBatch", digests);
+        }
+        for (auto kernel : {Tiger::Kernel::Portable, Tiger::Kernel::SSE42, Tiger::Kernel::AVX2, Tiger::Kernel::AVX512}) {
+            if (! Tiger::SelectKernel (kernel)) {
+                continue;
+            }
+            std::string const suffix = std::string {" ("} + Tiger::KernelName (kernel) + ")";
+            checkBatch ("MultiGenerator<2>" + suffix, multi_generator<2> (sbox, passes, isTiger2, batch, sizes));
+            checkBatch ("MultiGenerator<4>" + suffix, multi_generator<4> (sbox, passes, isTiger2, batch, sizes));
+            checkBatch ("MultiGenerator<8>" + suffix, multi_generator<8> (sbox, passes, isTiger2, batch, sizes));
+        }
+        Tiger::SelectKernel (Tiger::Kernel::Auto);
+        return result;
+    }
+}  // namespace TigerFuzz
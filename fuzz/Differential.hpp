@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Differential testing of every hashing path against the reference.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TigerFuzz {
+    /**
+     * Hashes the message decoded from the INPUT along every path and compares the digests with `ReferenceHash`.
+     *
+     * The INPUT is decoded as:
+     *
+     *   [0]     # of passes (3 + value % 6)
+     *   [1]     Flags (bit 0: Tiger2 padding, bit 1: seeded SBox)
+     *   [2]     Seed of the SBox
+     *   [3, 5)  Seed of the random splits of the message
+     *   [5, )   The message
+     *
+     * The paths cover `Generator` (in one call, random splits, byte by byte,
+     * scattered, `Peek` and `SaveState` in the middle), `BasicGenerator`,
+     * `Hash`/`Hash2`, `Context`, `HashBatch` and `MultiGenerator` with every
+     * available kernel.
+     *
+     * @param data The input
+     * @param size # of bytes in the input
+     *
+     * @return The diverging paths (empty if all agree)
+     */
+    std::vector<std::string> Check (const uint8_t *data, size_t size);
+}  // namespace TigerFuzz
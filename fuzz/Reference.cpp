@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Reference.hpp"
+
+#include <vector>
+
+namespace TigerFuzz {
+    namespace {
+        uint64_t load (const uint8_t *p) {
+            uint64_t result = 0;
+            for (int i = 7; 0 <= i; --i) {
+                result = (result << 8u) | p[i];
+            }
+            return result;
+        }
+
+        uint8_t byte_of (uint64_t v, unsigned int idx) {
+            return static_cast<uint8_t> (v >> (8u * idx));
+        }
+
+        /// The compression function (section 3 of the paper).
+        void compress (uint64_t (&state)[3], const uint8_t *block, const Tiger::sbox_t &sbox, size_t passes) {
+            auto t = [&sbox] (size_t table, uint8_t idx) { return sbox[256 * table + idx]; };
+
+            uint64_t x[8];
+            for (size_t i = 0; i < 8; ++i) {
+                x[i] = load (block + 8 * i);
+            }
+            auto round = [&t] (uint64_t &a, uint64_t &b, uint64_t &c, uint64_t xi, uint64_t mul) {
+                c ^= xi;
+                a -= t (0, byte_of (c, 0)) ^ t (1, byte_of (c, 2)) ^ t (2, byte_of (c, 4)) ^ t (3, byte_of (c, 6));
+                b += t (3, byte_of (c, 1)) ^ t (2, byte_of (c, 3)) ^ t (1, byte_of (c, 5)) ^ t (0, byte_of (c, 7));
+                b *= mul;
+            };
+            auto pass = [&round, &x] (uint64_t &a, uint64_t &b, uint64_t &c, uint64_t mul) {
+                round (a, b, c, x[0], mul);
+                round (b, c, a, x[1], mul);
+                round (c, a, b, x[2], mul);
+                round (a, b, c, x[3], mul);
+                round (b, c, a, x[4], mul);
+                round (c, a, b, x[5], mul);
+                round (a, b, c, x[6], mul);
+                round (b, c, a, x[7], mul);
+            };
+            auto key_schedule = [&x] () {
+                x[0] -= x[7] ^ 0xA5A5A5A5A5A5A5A5uLL;
+                x[1] ^= x[0];
+                x[2] += x[1];
+                x[3] -= x[2] ^ ((~x[1]) << 19u);
+                x[4] ^= x[3];
+                x[5] += x[4];
+                x[6] -= x[5] ^ ((~x[4]) >> 23u);
+                x[7] ^= x[6];
+                x[0] += x[7];
+                x[1] -= x[0] ^ ((~x[7]) << 19u);
+                x[2] ^= x[1];
+                x[3] += x[2];
+                x[4] -= x[3] ^ ((~x[2]) >> 23u);
+                x[5] ^= x[4];
+                x[6] += x[5];
+                x[7] -= x[6] ^ 0x0123456789ABCDEFuLL;
+            };
+            uint64_t a = state[0];
+            uint64_t b = state[1];
+            uint64_t c = state[2];
+
+            pass (a, b, c, 5);
+            key_schedule ();
+            pass (c, a, b, 7);
+            key_schedule ();
+            pass (b, c, a, 9);
+            for (size_t i = 3; i < passes; ++i) {
+                key_schedule ();
+                pass (a, b, c, 9);
+                uint64_t tmp = a;
+                a            = c;
+                c            = b;
+                b            = tmp;
+            }
+            state[0] = a ^ state[0];
+            state[1] = b - state[1];
+            state[2] = c + state[2];
+        }
+    }  // namespace
+
+    Tiger::digest_t ReferenceHash (const Tiger::sbox_t &sbox, const void *data, size_t size, size_t passes, bool isTiger2) {
+        auto const          *p = static_cast<const uint8_t *> (data);
+        std::vector<uint8_t> msg (p, p + size);
+
+        // Pads to 56 (mod 64) bytes and appends the length in bits (in little-endian).
+        msg.push_back (isTiger2 ? 0x80 : 0x01);
+        while (msg.size () % 64 != 56) {
+            msg.push_back (0);
+        }
+        uint64_t bits = 8 * static_cast<uint64_t> (size);
+        for (size_t i = 0; i < 8; ++i) {
+            msg.push_back (byte_of (bits, static_cast<unsigned int> (i)));
+        }
+        uint64_t state[3] = {0x0123456789ABCDEFuLL, 0xFEDCBA9876543210uLL, 0xF096A5B4C3B2E187uLL};
+        for (size_t off = 0; off < msg.size (); off += 64) {
+            compress (state, &msg[off], sbox, passes);
+        }
+        Tiger::digest_t result;
+        for (size_t i = 0; i < result.size (); ++i) {
+            result[i] = byte_of (state[i / 8], static_cast<unsigned int> (i % 8));
+        }
+        return result;
+    }
+}  // namespace TigerFuzz
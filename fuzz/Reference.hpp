@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief The straightforward Tiger (as in the paper) to check the library against.
+#pragma once
+
+#include <Tiger.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TigerFuzz {
+    /**
+     * Computes the digest byte by byte without any of the library internals.
+     *
+     * @param sbox     The sbox
+     * @param data     The message
+     * @param size     # of bytes in the message
+     * @param passes   # of passes (>= 3)
+     * @param isTiger2 Use Tiger2 padding
+     *
+     * @return The digest
+     */
+    Tiger::digest_t ReferenceHash (const Tiger::sbox_t &sbox, const void *data, size_t size, size_t passes, bool isTiger2);
+}  // namespace TigerFuzz
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief fuzz-tiger: The libFuzzer entry point of the differential checks.
+
+#include "Differential.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+extern "C" int LLVMFuzzerTestOneInput (const uint8_t *data, size_t size) {
+    auto const failed = TigerFuzz::Check (data, size);
+    for (auto const &path : failed) {
+        std::fprintf (stderr, "%s diverges from the reference (%zu bytes)\n", path.c_str (), size);
+    }
+    if (! failed.empty ()) {
+        std::abort ();
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief differential-tiger: Runs the differential checks on the random (or the given) inputs.
+
+#include "Differential.hpp"
+
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    void usage (FILE *out) {
+        fmt::print (out,
+                    "Usage: differential-tiger [OPTION]... [FILE]...\n"
+                    "Compares every hashing path with the reference implementation.\n"
+                    "With FILEs, replays them as the inputs (e.g. the crashes found by fuzz-tiger).\n"
+                    "\n"
+                    "  -n N    # of random inputs (default: 1000)\n"
+                    "  -s N    Seed of the random inputs (default: 0)\n"
+                    "  -h      Shows this help\n");
+    }
+
+    /// Makes the random input (mostly short, sometimes spanning many blocks).
+    std::vector<uint8_t> random_input (std::mt19937_64 &rng) {
+        size_t size;
+        switch (rng () % 8) {
+        case 0: size = rng () % 16; break;
+        case 1:
+        case 2: size = 5 + 64 * (1 + rng () % 8) + (rng () % 17) - 8; break;
+        case 7: size = rng () % (1u << 17u); break;
+        default: size = rng () % 2048; break;
+        }
+        std::vector<uint8_t> result (size);
+        auto const           fill = rng () % 4;  // Low entropy messages now and then
+        for (auto &b : result) {
+            b = static_cast<uint8_t> (fill == 0 ? 'a' : rng ());
+        }
+        for (size_t i = 0; i < 5 && i < size; ++i) {
+            result[i] = static_cast<uint8_t> (rng ());
+        }
+        return result;
+    }
+
+    bool run (const std::vector<uint8_t> &input, const std::string &name) {
+        auto const failed = TigerFuzz::Check (input.data (), input.size ());
+        for (auto const &path : failed) {
+            fmt::print (stderr, "{}: {} diverges from the reference ({} bytes)\n", name, path, input.size ());
+        }
+        return failed.empty ();
+    }
+
+    /// Saves the failing INPUT for replaying.
+    void save (const std::vector<uint8_t> &input, const std::string &path) {
+        std::ofstream out {path, std::ios::binary};
+        out.write (reinterpret_cast<const char *> (input.data ()), static_cast<std::streamsize> (input.size ()));
+    }
+}  // namespace
+
+int main (int argc, char **argv) {
+    size_t                   count = 1000;
+    uint64_t                 seed  = 0;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; ++i) {
+        if (::strcmp (argv[i], "-n") == 0 && i + 1 < argc) {
+            count = std::strtoull (argv[++i], nullptr, 0);
+        }
+        else if (::strcmp (argv[i], "-s") == 0 && i + 1 < argc) {
+            seed = std::strtoull (argv[++i], nullptr, 0);
+        }
+        else if (::strcmp (argv[i], "-h") == 0) {
+            usage (stdout);
+            return 0;
+        }
+        else if (argv[i][0] == '-') {
+            usage (stderr);
+            return 2;
+        }
+        else {
+            files.emplace_back (argv[i]);
+        }
+    }
+
+    size_t cntFailed = 0;
+    if (! files.empty ()) {
+        for (auto const &path : files) {
+            std::ifstream in {path, std::ios::binary};
+            if (! in) {
+                fmt::print (stderr, "{}: Cannot open\n", path);
+                return 2;
+            }
+            std::vector<uint8_t> input {std::istreambuf_iterator<char> {in}, std::istreambuf_iterator<char> {}};
+            cntFailed += run (input, path) ? 0 : 1;
+        }
+    }
+    else {
+        std::mt19937_64 rng {seed};
+        for (size_t i = 0; i < count; ++i) {
+            auto const input = random_input (rng);
+            auto const name  = fmt::format ("input-{}-{}", seed, i);
+            if (! run (input, name)) {
+                save (input, name + ".bin");
+                ++cntFailed;
+            }
+        }
+    }
+    if (0 < cntFailed) {
+        fmt::print (stderr, "{} input(s) failed\n", cntFailed);
+        return 1;
+    }
+    return 0;
+}
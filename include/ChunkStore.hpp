@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Deduplicating the content-defined chunks.
+#pragma once
+
+#include "Chunker.hpp"
+#include "DigestIndex.hpp"
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Tiger {
+    /** Options for `ChunkStore`.  */
+    struct ChunkStoreOptions {
+        ChunkerOptions chunker;
+        size_t         cntThread = 1;  ///< # of threads hashing the chunks (see `HashBatch`).  0 uses all hardware threads.
+        size_t         capacity  = 0;  ///< # of chunks to hold without growing the index
+    };
+
+    /** A chunk of the ingested stream.  */
+    struct ChunkRef {
+        digest_t digest;
+        uint64_t id     = 0;  ///< Sequential # of the distinct chunk (in the order first seen)
+        uint64_t offset = 0;  ///< Offset in the stream
+        uint32_t size   = 0;  ///< Up to `Chunker::MAX_CHUNK_SIZE`
+        bool     isNew  = false;  ///< Seen for the first time (its contents should be stored)
+    };
+
+    /**
+     * Deduplicates a stream by the digests of its content-defined chunks.
+     *
+     * The stream is cut by the `Chunker`, the chunks are hashed by
+     * `HashBatch` and looked up in (or added to) the `DigestIndex` which
+     * maps the digests to the chunk ids.  Storing the contents of the new
+     * chunks is up to the caller.
+     */
+    class ChunkStore {
+    private:
+        Chunker     chunker_;
+        DigestIndex index_;
+        size_t      cntThread_;
+        uint64_t    offset_ = 0;  ///< # of bytes ingested
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param options Options
+         */
+        explicit ChunkStore (const ChunkStoreOptions &options = ChunkStoreOptions {});
+
+        /**
+         * The constructor resuming with the index (of the chunk ids).
+         *
+         * @param index   The index (see `DigestIndex::Load`)
+         * @param options Options
+         */
+        ChunkStore (DigestIndex index, const ChunkStoreOptions &options);
+
+        /**
+         * Ingests the bytes of the stream.
+         *
+         * @remarks Unless ISLAST, the trailing bytes after the last boundary
+         *          are left unconsumed: Feed them again with the following bytes.
+         * @param data   The bytes following the ones consumed so far
+         * @param size   # of bytes
+         * @param isLast DATA reaches the end of the stream
+         * @param result Receives the chunks (appended)
+         *
+         * @return # of bytes consumed
+         */
+        size_t Ingest (const void *data, size_t size, bool isLast, std::vector<ChunkRef> &result);
+
+        /** The index of the distinct chunks.  */
+        const DigestIndex &Index () const { return index_; }
+
+        /** # of bytes ingested.  */
+        uint64_t Offset () const { return offset_; }
+    };
+}  // namespace Tiger
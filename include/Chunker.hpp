@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Content-defined chunking.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Tiger {
+    /** Options for `Chunker`.  */
+    struct ChunkerOptions {
+        size_t minSize = 2u << 10u;   ///< No cut before this
+        size_t avgSize = 8u << 10u;   ///< The expected chunk size (rounded down to a power of 2)
+        size_t maxSize = 64u << 10u;  ///< Always cut here
+    };
+
+    /**
+     * Splits a stream into the content-defined chunks.
+     *
+     * Rolls the gear hash (`h = (h << 1) + gear[byte]`) over the bytes and
+     * cuts where its upper bits are all 0, so the boundaries follow the
+     * contents and survive the insertions and the deletions elsewhere.
+     * The chunk sizes are normalized around the average as in FastCDC: A
+     * stricter mask is used below the average and a looser one above it.
+     *
+     * The gear table is the first table of the `DefaultSBox ()`.
+     */
+    class Chunker {
+    public:
+        /// The largest chunk (the sizes fit in `ChunkRef::size`).
+        static const size_t MAX_CHUNK_SIZE = UINT32_MAX;
+
+    private:
+        size_t   minSize_;
+        size_t   avgSize_;
+        size_t   maxSize_;
+        uint64_t maskSmall_;  ///< Used below the average size
+        uint64_t maskLarge_;  ///< Used above the average size
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param options Options (the sizes are clamped to be ordered and up to MAX_CHUNK_SIZE)
+         */
+        explicit Chunker (const ChunkerOptions &options = ChunkerOptions {}) noexcept;
+
+        /**
+         * Finds the end of the chunk starting at DATA.
+         *
+         * @remarks A result equal to SIZE (and less than the maximum size)
+         *          means no boundary was found: The chunk may continue past
+         *          DATA + SIZE unless this is the end of the stream.
+         * @param data The bytes following the previous boundary
+         * @param size # of bytes available
+         *
+         * @return # of bytes in the chunk
+         */
+        size_t Next (const void *data, size_t size) const noexcept;
+
+        size_t MinSize () const { return minSize_; }
+
+        size_t AvgSize () const { return avgSize_; }
+
+        size_t MaxSize () const { return maxSize_; }
+    };
+}  // namespace Tiger
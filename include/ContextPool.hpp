@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Pooled hashing contexts.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Tiger {
+    /**
+     * A pool of `Context`s for the many concurrent streams.
+     *
+     * The contexts are carved from the slabs of SLAB_SIZE and recycled
+     * through a free list, so acquiring and releasing them allocates
+     * nothing in the steady state.  The contexts stay in place until the
+     * pool is destroyed.
+     *
+     * @remarks Not thread-safe: Use a pool per thread (or guard it).
+     */
+    class ContextPool {
+    public:
+        static const size_t SLAB_SIZE = 4096;
+
+    private:
+        std::vector<std::unique_ptr<Context[]>> slabs_;
+        std::vector<Context *>                  free_;
+        size_t                                  cntCarved_ = 0;  ///< # of contexts taken from the last slab
+        size_t                                  cntInUse_  = 0;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param capacity # of contexts to allocate up front
+         */
+        explicit ContextPool (size_t capacity = 0);
+
+        ContextPool (const ContextPool &) = delete;
+        ContextPool &operator= (const ContextPool &) = delete;
+
+        /**
+         * Takes a context for a new stream.
+         *
+         * @param cntPass # of iterations in the compression function
+         * @param padding The padding scheme
+         *
+         * @return The context (reset)
+         */
+        Context *Acquire (size_t cntPass = DEFAULT_PASSES, Padding padding = Padding::Tiger1);
+
+        /**
+         * Returns the context taken by `Acquire`.
+         *
+         * @param context The context
+         */
+        void Release (Context *context) noexcept;
+
+        /** # of contexts in use.  */
+        size_t Size () const { return cntInUse_; }
+
+        /** # of contexts allocated.  */
+        size_t Capacity () const { return SLAB_SIZE * slabs_.size (); }
+    };
+}  // namespace Tiger
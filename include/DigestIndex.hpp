@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Indices keyed on the digests.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Tiger {
+    /**
+     * An open-addressing hash table from the digests to 64 bits values.
+     *
+     * The slots are arranged in groups of 16 with a byte tag per slot (7
+     * bits taken from the digest, or 0 for the empty slot).  A lookup
+     * matches the 16 tags of a group at once (with SSE2 where available)
+     * and compares the digests of the matching slots only.  The digests
+     * are uniformly distributed, so their leading bytes serve as the hash.
+     *
+     * A slot costs 33 bytes.  The table starts with a group and grows by
+     * doubling at 7/8 load.  Entries are never removed.
+     */
+    class DigestIndex {
+    public:
+        static const size_t GROUP_SIZE = 16;
+
+        /** A slot (also the on-disk layout).  */
+        struct Entry {
+            digest_t               digest;
+            std::array<uint8_t, 8> value;  ///< In little-endian
+        };
+
+    private:
+        std::vector<uint8_t> tags_;
+        std::vector<Entry>   entries_;
+        size_t               count_ = 0;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param capacity # of entries to hold without growing
+         */
+        explicit DigestIndex (size_t capacity = 0);
+
+        /**
+         * Looks up the DIGEST.
+         *
+         * @param digest The key
+         * @param value  Receives the value if found
+         *
+         * @return true if found
+         */
+        bool Find (const digest_t &digest, uint64_t &value) const noexcept;
+
+        /**
+         * Inserts the DIGEST unless present.
+         *
+         * @param digest The key
+         * @param value  The value
+         *
+         * @return The value stored for the DIGEST, and true if inserted now
+         */
+        std::pair<uint64_t, bool> Insert (const digest_t &digest, uint64_t value);
+
+        /**
+         * Makes the room for COUNT entries.
+         *
+         * @param count # of entries to hold without growing
+         */
+        void Reserve (size_t count);
+
+        /** # of entries.  */
+        size_t Size () const { return count_; }
+
+        /** # of slots.  */
+        size_t Capacity () const { return entries_.size (); }
+
+        /**
+         * Writes the index to the file (replacing it atomically).
+         *
+         * @remarks The file is independent of the host byte order and can
+         *          be looked up in place with `MappedDigestIndex`.
+         * @param path The file
+         * @throw std::system_error on I/O errors
+         */
+        void Save (const std::string &path) const;
+
+        /**
+         * Reads the index written by `Save`.
+         *
+         * @param path The file
+         * @return The index
+         * @throw std::system_error on I/O errors (std::errc::invalid_argument if malformed)
+         */
+        static DigestIndex Load (const std::string &path);
+    };
+
+    /**
+     * A read-only `DigestIndex` mapped from the file written by `DigestIndex::Save`.
+     *
+     * Lookups touch the pages of the probed groups only, so a large index
+     * can be opened without reading it.
+     */
+    class MappedDigestIndex {
+    private:
+        void *                    addr_     = nullptr;
+        size_t                    size_     = 0;
+        const uint8_t *           tags_     = nullptr;
+        const DigestIndex::Entry *entries_  = nullptr;
+        size_t                    cntGroup_ = 0;
+        size_t                    count_    = 0;
+        std::vector<uint8_t>      owned_;  ///< The contents, if not mapped
+
+    public:
+        /**
+         * Maps the index.
+         *
+         * @param path The file
+         * @throw std::system_error on I/O errors (std::errc::invalid_argument if malformed)
+         */
+        explicit MappedDigestIndex (const std::string &path);
+
+        MappedDigestIndex (const MappedDigestIndex &) = delete;
+        MappedDigestIndex &operator= (const MappedDigestIndex &) = delete;
+
+        ~MappedDigestIndex ();
+
+        /**
+         * Looks up the DIGEST.
+         *
+         * @param digest The key
+         * @param value  Receives the value if found
+         *
+         * @return true if found
+         */
+        bool Find (const digest_t &digest, uint64_t &value) const noexcept;
+
+        /** # of entries.  */
+        size_t Size () const { return count_; }
+    };
+}  // namespace Tiger
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Hashing many messages at once.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Tiger {
+    /** Options for `HashBatch`.  */
+    struct HashBatchOptions {
+        const sbox_t *sbox      = nullptr;  ///< The sbox (nullptr: `DefaultSBox ()`)
+        size_t        passes    = DEFAULT_PASSES;
+        Padding       padding   = Padding::Tiger1;
+        size_t        cntThread = 1;    ///< # of threads (including the caller's).  0 uses all hardware threads.
+        size_t        grain     = 256;  ///< # of messages handed to a thread at a time
+    };
+
+    /**
+     * Computes digests of many independent messages.
+     *
+     * The messages are hashed straight from their storage with 8
+     * interleaved lanes (see `MultiGenerator`): the final (padded) blocks
+     * are built once per message and no intermediate buffering takes
+     * place.  The batch is split into GRAIN sized chunks which are spread
+     * over the threads.
+     *
+     * The results are bit-identical to the ones computed by `Generator`.
+     *
+     * @remarks The worker threads are kept (per calling thread) for the
+     *          following batches with the same # of threads.
+     *
+     * @param result  Receives COUNT digests
+     * @param inputs  The messages
+     * @param count   # of messages
+     * @param options Options
+     */
+    void HashBatch (digest_t *result, const ByteView *inputs, size_t count, const HashBatchOptions &options = HashBatchOptions {});
+}  // namespace Tiger
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Hashing files.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Tiger {
+    /** Options for `HashFile`.  */
+    struct HashFileOptions {
+        const sbox_t *sbox       = nullptr;  ///< The sbox (nullptr: `DefaultSBox ()`)
+        size_t        passes     = DEFAULT_PASSES;
+        Padding       padding    = Padding::Tiger1;
+        bool          useMmap    = true;       ///< Maps regular files instead of reading them
+        size_t        bufferSize = 1u << 20u;  ///< Size of each read-ahead buffer
+        size_t        cntBuffer  = 4;          ///< # of read-ahead buffers in flight
+    };
+
+    /** Result of `HashFile`.  */
+    struct HashFileResult {
+        digest_t digest;
+        uint64_t size    = 0;      ///< # of bytes hashed
+        double   seconds = 0.0;    ///< Elapsed time
+        bool     mapped  = false;  ///< The file was memory-mapped
+
+        /** Throughput in bytes/s.  */
+        double BytesPerSecond () const { return 0.0 < seconds ? static_cast<double> (size) / seconds : 0.0; }
+    };
+
+    /**
+     * Computes the digest of a file.
+     *
+     * Regular files are memory-mapped (with sequential/read-ahead advices)
+     * and compressed straight from the mapping.  Pipes and other special
+     * files are read by a background thread into a ring of buffers while
+     * the calling thread compresses the filled ones.
+     *
+     * @param path    The file to hash
+     * @param options Options
+     *
+     * @return The digest with the statistics
+     * @throw std::system_error on I/O errors
+     */
+    HashFileResult HashFile (const std::string &path, const HashFileOptions &options = HashFileOptions {});
+
+    /** Result of `FileTail::Refresh`.  */
+    struct FileTailResult {
+        digest_t digest;             ///< Digest of the whole file (as of the refresh)
+        uint64_t size      = 0;      ///< # of bytes in the file
+        uint64_t appended  = 0;      ///< # of bytes hashed by the refresh
+        bool     restarted = false;  ///< The file was truncated or replaced and rehashed from the start
+    };
+
+    /**
+     * Tracks the digest of a growing (append-only) file.
+     *
+     * Keeps the running state between the refreshes and hashes the appended
+     * bytes only.  The state can be persisted with `SaveState` to resume
+     * after a restart.
+     */
+    class FileTail {
+    private:
+        std::string     path_;
+        HashFileOptions options_;
+        Generator       gen_;
+        uint64_t        device_ = 0;
+        uint64_t        inode_  = 0;
+        bool            known_  = false;  ///< The device_/inode_ are valid
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param path    The file to track
+         * @param options Options (`useMmap` and `cntBuffer` are not used)
+         */
+        explicit FileTail (const std::string &path, const HashFileOptions &options = HashFileOptions {});
+
+        /**
+         * Hashes the bytes appended since the last refresh.
+         *
+         * @remarks Rehashes the whole file if it got shorter or was replaced.
+         * @return The digest of the current contents
+         * @throw std::system_error on I/O errors
+         */
+        FileTailResult Refresh ();
+
+        /** # of bytes hashed so far.  */
+        uint64_t Offset () const { return gen_.Count (); }
+
+        /**
+         * Serializes the running state (see `Generator::SaveState`).
+         *
+         * @return The serialized state
+         */
+        savedstate_t SaveState () const noexcept { return gen_.SaveState (); }
+
+        /**
+         * Restores the running state saved by `SaveState`.
+         *
+         * @param state The serialized state
+         * @return false if STATE is not usable (see `Generator::RestoreState`)
+         */
+        bool RestoreState (const savedstate_t &state) noexcept {
+            known_ = false;
+            return gen_.RestoreState (state);
+        }
+    };
+}  // namespace Tiger
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief HMAC over Tiger (RFC 2104).
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Tiger {
+    /**
+     * HMAC-Tiger under a fixed key.
+     *
+     * The chaining states after the (padded) key block XORed with the
+     * ipad/opad are computed once by the constructor.  Each MAC costs the
+     * message blocks plus a single outer block.
+     */
+    class Hmac {
+    public:
+        static const size_t BLOCK_SIZE = 64;
+
+    private:
+        const sbox_t &sbox_;
+        size_t        cntPass_;
+        bool          isTiger2_;
+        state_t       inner_;  ///< After the key block XORed with the ipad
+        state_t       outer_;  ///< After the key block XORed with the opad
+
+    public:
+        /**
+         * The constructor with the default SBox.
+         *
+         * @param key     The key (hashed first if longer than BLOCK_SIZE)
+         * @param keySize # of bytes in the key
+         */
+        Hmac (const void *key, size_t keySize) noexcept : Hmac (DefaultSBox (), key, keySize) { /* NO-OP */
+        }
+
+        /**
+         * The constructor.
+         *
+         * @param sbox    The sbox
+         * @param key     The key (hashed first if longer than BLOCK_SIZE)
+         * @param keySize # of bytes in the key
+         * @param cntPass # of iterations in the compression function
+         * @param padding The padding scheme of the underlying hash
+         */
+        Hmac (const sbox_t &sbox, const void *key, size_t keySize, size_t cntPass = DEFAULT_PASSES, Padding padding = Padding::Tiger1) noexcept;
+
+        /**
+         * Computes the MAC of a message.
+         *
+         * @param data The message
+         * @param size # of bytes in the message
+         *
+         * @return The MAC
+         */
+        digest_t Mac (const void *data, size_t size) const noexcept;
+
+        /**
+         * Computes the MACs of many messages.
+         *
+         * @remarks Both the inner and the outer hashes run in 8 interleaved lanes (see `MultiGenerator`).
+         * @param result Receives COUNT MACs
+         * @param inputs The messages
+         * @param count  # of messages
+         */
+        void Mac (digest_t *result, const ByteView *inputs, size_t count) const noexcept;
+
+        /**
+         * Verifies the MAC of a message.
+         *
+         * @remarks The comparison takes the same time wherever the MACs differ.
+         * @param mac  The MAC to verify
+         * @param data The message
+         * @param size # of bytes in the message
+         *
+         * @return true if MAC is the one of the message
+         */
+        bool Verify (const digest_t &mac, const void *data, size_t size) const noexcept;
+    };
+
+    /**
+     * Compares the digests in constant time.
+     *
+     * @param a The digest
+     * @param b The digest
+     *
+     * @return true if identical
+     */
+    bool DigestEqual (const digest_t &a, const digest_t &b) noexcept;
+}  // namespace Tiger
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Opt-in counters of the generators.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace Tiger {
+    /** Counters collected by the generators (`Generator` and `BasicGenerator`).  */
+    struct Counters {
+        /// # of buckets in `updateSizes`.
+        static const size_t HISTOGRAM_SIZE = 16;
+
+        uint64_t blocks    = 0;  ///< # of blocks compressed
+        uint64_t bytes     = 0;  ///< # of bytes fed by `Update`
+        uint64_t updates   = 0;  ///< # of `Update` calls
+        uint64_t finalizes = 0;  ///< # of `Finalize` calls
+        uint64_t cycles    = 0;  ///< Cycles (TSC, or ns where not available) spent in the compression (see `EnableCycleTiming`)
+
+        /// # of `Update` calls by the size: `[0]` for the empty ones, `[i]` for [2^(i-1), 2^i) bytes and the last one for the rest.
+        std::array<uint64_t, HISTOGRAM_SIZE> updateSizes {};
+
+        Counters &operator+= (const Counters &other) noexcept;
+    };
+
+    /**
+     * Checks whether the instrumentation is compiled in.
+     *
+     * @remarks Enabled by the `ENABLE_INSTRUMENTATION` CMake option.  Otherwise
+     *          the counters stay zero and the generators carry no overhead.
+     * @return true if the counters are collected
+     */
+    bool InstrumentationEnabled () noexcept;
+
+    /**
+     * Turns on/off the cycle timing around the compression function.
+     *
+     * @remarks Off by default (it costs two time stamp reads per block).
+     * @param enable Enables the timing
+     */
+    void EnableCycleTiming (bool enable) noexcept;
+
+    /**
+     * Retrieves the counters of the calling thread.
+     *
+     * @return The counters
+     */
+    Counters ThreadCounters () noexcept;
+
+    /**
+     * Sums up the counters of all threads (including the exited ones).
+     *
+     * @return The total
+     */
+    Counters CollectCounters () noexcept;
+
+    /**
+     * Visits the counters of the live threads.
+     *
+     * @param visitor Called with the thread id and its counters
+     */
+    void VisitCounters (const std::function<void (std::thread::id id, const Counters &counters)> &visitor);
+
+    /**
+     * Clears the counters of all threads.
+     *
+     * @remarks The counts of the threads hashing meanwhile may survive.
+     */
+    void ResetCounters () noexcept;
+}  // namespace Tiger
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Selection of the multi-lane compression kernels.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Tiger {
+    /**
+     * Compression kernels used for the multi-lane hashing (`MultiGenerator`).
+     *
+     * The kernel is selected once from the CPU features.  The `TIGER_KERNEL`
+     * environment variable (`portable`, `sse42`, `avx2` or `avx512`) pins a
+     * kernel at the startup and `SelectKernel` overrides it afterwards.
+     */
+    enum class Kernel {
+        Auto,      ///< The best kernel available
+        Portable,  ///< The interleaved scalar kernel
+        SSE42,     ///< The interleaved scalar kernel compiled for SSE4.2 (never selected automatically)
+        AVX2,      ///< 4 lanes per vector with `vpgatherqq` (never selected automatically)
+        AVX512,    ///< 8 lanes per vector with `vpgatherqq`
+    };
+
+    /**
+     * Retrieves the name of the kernel.
+     *
+     * @param kernel The kernel
+     *
+     * @return The name (as accepted by the `TIGER_KERNEL`)
+     */
+    const char *KernelName (Kernel kernel) noexcept;
+
+    /**
+     * Checks whether the kernel runs on this CPU.
+     *
+     * @param kernel The kernel
+     *
+     * @return true if the KERNEL is available
+     */
+    bool IsKernelAvailable (Kernel kernel) noexcept;
+
+    /**
+     * Retrieves the kernel in use.
+     *
+     * @return The active kernel (never `Kernel::Auto`)
+     */
+    Kernel ActiveKernel () noexcept;
+
+    /**
+     * Pins the kernel.
+     *
+     * @param kernel The kernel to use.  `Kernel::Auto` restores the automatic selection.
+     *
+     * @return false if the KERNEL is not available (the active kernel is left unchanged)
+     */
+    bool SelectKernel (Kernel kernel) noexcept;
+}  // namespace Tiger
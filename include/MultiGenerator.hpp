@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Multi-buffer Tiger192 generator.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Tiger {
+    /**
+     * Hashes many independent messages with N_ interleaved lanes.
+     *
+     * The compression functions of the lanes run in lockstep so that the
+     * S-box lookups of one lane hide the latency of the others.  A lane is
+     * retired as soon as its message is exhausted and is refilled with the
+     * next pending one, so messages of unequal length are handled without
+     * stalling the remaining lanes.
+     *
+     * The results are bit-identical to the ones computed by `Generator`.
+     */
+    template <size_t N_>
+    class MultiGenerator {
+        static_assert (N_ == 2 || N_ == 4 || N_ == 8, "Supported # of lanes are 2, 4 and 8");
+
+    public:
+        static constexpr size_t LANES = N_;
+
+    private:
+        const sbox_t &sbox_;
+        size_t        cntPass_;
+        bool          isTiger2_;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param sbox The sbox
+         */
+        explicit MultiGenerator (const sbox_t &sbox) : MultiGenerator (sbox, DEFAULT_PASSES, false) { /* NO-OP */
+        }
+
+        /**
+         * The constructor with the explicit pass counts.
+         *
+         * @param sbox    The sbox
+         * @param cntPass # of iterations in the compression function
+         */
+        MultiGenerator (const sbox_t &sbox, size_t cntPass) : MultiGenerator (sbox, cntPass, false) { /* NO-OP */
+        }
+
+        /**
+         * The constructor with the explicit pass counts.
+         *
+         * @param sbox     The sbox
+         * @param cntPass  # of iterations in the compression function.
+         * @param isTiger2 Use Tiger2 padding
+         */
+        MultiGenerator (const sbox_t &sbox, size_t cntPass, bool isTiger2) noexcept;
+
+        bool IsTiger2 () const { return isTiger2_; }
+
+        /**
+         * Computes digests of the messages.
+         *
+         * @param result Receives COUNT digests
+         * @param data   The input sequences
+         * @param sizes  # of bytes in each input sequence
+         * @param count  # of messages
+         */
+        void Hash (digest_t *result, const void *const *data, const size_t *sizes, size_t count) const noexcept;
+
+        /**
+         * Computes digests of exactly N_ messages.
+         *
+         * @param data   The input sequences
+         * @param sizes  # of bytes in each input sequence
+         *
+         * @return Computed digests
+         */
+        std::array<digest_t, N_> Hash (const std::array<const void *, N_> &data, const std::array<size_t, N_> &sizes) const noexcept {
+            std::array<digest_t, N_> result;
+            Hash (result.data (), data.data (), sizes.data (), N_);
+            return result;
+        }
+    };
+
+    extern template class MultiGenerator<2>;
+    extern template class MultiGenerator<4>;
+    extern template class MultiGenerator<8>;
+}  // namespace Tiger
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Building and caching the seeded S-boxes.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Tiger {
+    /**
+     * Initializes many seeded SBoxes concurrently.
+     *
+     * @remarks Each table is identical to the one by `InitializeSBox (sbox, seed, seed_size, passes)`.
+     * @param result    Receives COUNT SBoxes
+     * @param seeds     The seeds
+     * @param count     # of seeds
+     * @param passes    # of passes to apply
+     * @param cntThread # of threads (including the caller's).  0 uses all hardware threads.
+     */
+    void BuildSBoxes (sbox_t *result, const ByteView *seeds, size_t count, size_t passes, size_t cntThread = 0);
+
+    /**
+     * An on-disk cache of the seeded SBoxes.
+     *
+     * A table is stored in its own file named after the digest of the seed
+     * and the # of passes, as the little-endian words followed by a trailer
+     * with its fingerprint.  Cached tables are memory-mapped (read-only and
+     * shared among the processes) instead of being regenerated.  New files
+     * are written to a temporary and renamed, so the concurrent writers
+     * never expose a partial table.
+     */
+    class SBoxCache {
+    private:
+        struct Entry;
+
+        std::string                                    directory_;
+        std::mutex                                     mutex_;
+        std::map<std::string, std::unique_ptr<Entry>> entries_;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param directory The cache directory (created if missing)
+         * @throw std::system_error if DIRECTORY could not be created
+         */
+        explicit SBoxCache (const std::string &directory);
+
+        SBoxCache (const SBoxCache &) = delete;
+        SBoxCache &operator= (const SBoxCache &) = delete;
+
+        ~SBoxCache ();
+
+        /**
+         * Retrieves the SBox for the seed, building and storing it if not cached yet.
+         *
+         * @param seed      Seed for sbox initialization
+         * @param seed_size The seed size
+         * @param passes    # of passes to apply
+         *
+         * @return The SBox (valid during the lifetime of this)
+         * @throw std::system_error on I/O errors
+         */
+        const sbox_t &Get (const void *seed, size_t seed_size, size_t passes);
+
+        /**
+         * Retrieves many SBoxes at once.  The missing ones are built concurrently.
+         *
+         * @param result    Receives COUNT SBoxes (valid during the lifetime of this)
+         * @param seeds     The seeds
+         * @param count     # of seeds
+         * @param passes    # of passes to apply
+         * @param cntThread # of threads used to build the missing ones.  0 uses all hardware threads.
+         *
+         * @throw std::system_error on I/O errors
+         */
+        void Get (const sbox_t **result, const ByteView *seeds, size_t count, size_t passes, size_t cntThread = 0);
+
+        /**
+         * Retrieves the path of the file caching the SBox.
+         *
+         * @param seed      Seed for sbox initialization
+         * @param seed_size The seed size
+         * @param passes    # of passes to apply
+         *
+         * @return The path
+         */
+        std::string PathOf (const void *seed, size_t seed_size, size_t passes) const;
+
+    private:
+        const sbox_t *Find (const std::string &path);
+        const sbox_t &Store (const std::string &path, const sbox_t &sbox);
+    };
+}  // namespace Tiger
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief NUMA-local copies of an S-box.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace Tiger {
+    /**
+     * Keeps a copy of an SBox per NUMA node.
+     *
+     * Each replica lives in its own page-aligned mapping bound to its node
+     * (with `mbind` on Linux), so the kernel places it in the node local
+     * memory whichever thread creates it.  The lookups of the hashing
+     * threads then never cross the interconnect and the replicas never
+     * share a cache line (or a page) with other data.
+     *
+     * Falls back to a single replica where the node is not available.
+     */
+    class SBoxReplicas {
+    public:
+        /// Maximum # of nodes tracked (the others share the replica of node 0).
+        static const size_t MAX_NODES = 64;
+
+    private:
+        sbox_t                                   source_;
+        size_t                                   cntNode_;
+        std::mutex                               mutex_;
+        std::unique_ptr<std::atomic<sbox_t *>[]> replicas_;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param sbox The sbox to be replicated (in any layout)
+         */
+        explicit SBoxReplicas (const sbox_t &sbox);
+
+        SBoxReplicas (const SBoxReplicas &) = delete;
+        SBoxReplicas &operator= (const SBoxReplicas &) = delete;
+
+        ~SBoxReplicas ();
+
+        /** # of NUMA nodes in the system.  */
+        size_t NodeCount () const { return cntNode_; }
+
+        /**
+         * Retrieves the replica for the calling thread.
+         *
+         * @remarks Creates the replica on the first call from the node.
+         *          Stays valid until the destruction of this.
+         * @return The replica local to the NUMA node the calling thread runs on
+         */
+        const sbox_t &Local () noexcept;
+
+        /**
+         * Retrieves the replica for the specific node.
+         *
+         * @remarks Creates the replica on the first call for the NODE (in the
+         *          memory of the NODE even if called from another node).
+         * @param node The node (nodes past `NodeCount ()` share the replica of node 0)
+         * @return The replica
+         */
+        const sbox_t &Replica (size_t node) noexcept;
+    };
+}  // namespace Tiger
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Hashing streams with the input overlapped with the compression.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tiger {
+    /** Options for `StreamHasher`.  */
+    struct StreamHasherOptions {
+        const sbox_t *sbox       = nullptr;  ///< The sbox (nullptr: `DefaultSBox ()`)
+        size_t        passes     = DEFAULT_PASSES;
+        Padding       padding    = Padding::Tiger1;
+        size_t        bufferSize = 1u << 20u;  ///< Size of each buffer in the ring
+        size_t        cntBuffer  = 4;          ///< # of buffers in the ring
+    };
+
+    /** Result of `StreamHasher`.  */
+    struct StreamHasherResult {
+        digest_t digest;
+        uint64_t size          = 0;    ///< # of bytes hashed
+        double   seconds       = 0.0;  ///< Elapsed time (from the construction to the digest)
+        double   producerStall = 0.0;  ///< Time the producer waited for a free buffer (bound by the compression)
+        double   hasherStall   = 0.0;  ///< Time the hasher waited for a filled buffer (bound by the input)
+
+        /** Throughput in bytes/s.  */
+        double BytesPerSecond () const { return 0.0 < seconds ? static_cast<double> (size) / seconds : 0.0; }
+    };
+
+    /**
+     * Hashes a stream in 2 stages.
+     *
+     * The producer (the caller of `Write` or `Pump`) fills the buffers in a
+     * bounded ring while a background thread drains the filled ones into a
+     * `Generator`.  The producer blocks while all the buffers are in flight,
+     * so the end-to-end time approaches the larger of the input and the
+     * compression time instead of their sum.
+     */
+    class StreamHasher {
+    public:
+        /// Reads up to SIZE bytes.  Returns the # of bytes read (0 on EOF), or -errno.
+        using read_t = std::function<ptrdiff_t (uint8_t *buffer, size_t size)>;
+
+    private:
+        std::vector<std::vector<uint8_t>>      buffers_;
+        std::vector<size_t>                    sizes_;
+        Generator                              gen_;
+        std::mutex                             mutex_;
+        std::condition_variable                cond_;
+        size_t                                 head_          = 0;  ///< Next buffer to hash
+        size_t                                 filled_        = 0;  ///< # of filled buffers (including the one being hashed)
+        bool                                   closed_        = false;
+        size_t                                 tail_          = 0;        ///< The buffer being filled (producer only)
+        uint8_t *                              current_       = nullptr;  ///< Start of the buffer being filled, nullptr if none (producer only)
+        size_t                                 used_          = 0;        ///< # of bytes in the buffer being filled (producer only)
+        uint64_t                               count_         = 0;        ///< # of bytes fed (producer only)
+        bool                                   finalized_     = false;
+        double                                 producerStall_ = 0.0;
+        std::promise<StreamHasherResult>       promise_;
+        std::shared_future<StreamHasherResult> result_;
+        std::thread                            thread_;
+
+    public:
+        /**
+         * The constructor.  Starts the hasher thread.
+         *
+         * @param options Options
+         */
+        explicit StreamHasher (const StreamHasherOptions &options = StreamHasherOptions {});
+
+        StreamHasher (const StreamHasher &) = delete;
+        StreamHasher &operator= (const StreamHasher &) = delete;
+
+        /** Finalizes (if not yet) and waits for the hasher thread.  */
+        ~StreamHasher ();
+
+        /**
+         * Feeds the bytes.
+         *
+         * @remarks Copied into the ring.  Blocks while all the buffers are in flight.
+         *          Ignored once finalized.
+         * @param data The input sequence
+         * @param size # of bytes in the input sequence
+         *
+         * @return *this
+         */
+        StreamHasher &Write (const void *data, size_t size);
+
+        /**
+         * Feeds the bytes read by READ until EOF.
+         *
+         * @remarks READ fills the buffers in the ring directly (without copying).
+         * @param read The reader
+         *
+         * @return 0, or errno of the failed read
+         */
+        int Pump (const read_t &read);
+
+        /**
+         * Finishes the input and retrieves the (future) result.
+         *
+         * @remarks Does not wait for the hasher thread.  Successive calls return the same future.
+         * @return The result, ready when the hasher thread drained the ring
+         */
+        std::shared_future<StreamHasherResult> Finalize ();
+
+        /** # of bytes fed so far.  */
+        uint64_t Count () const { return count_; }
+
+    private:
+        /// Makes the buffer to fill available (blocking while none is free).
+        void Acquire ();
+        /// Hands the buffer being filled to the hasher thread.
+        void Submit ();
+        void Run ();
+    };
+
+    /**
+     * Hashes the bytes read by READ in the background.
+     *
+     * A reader thread pumps READ into a `StreamHasher` (see `StreamHasher::Pump`).
+     *
+     * @param read    The reader
+     * @param options Options
+     *
+     * @return The result (throws std::system_error on read errors when retrieved)
+     */
+    std::future<StreamHasherResult> HashStream (StreamHasher::read_t read, const StreamHasherOptions &options = StreamHasherOptions {});
+}  // namespace Tiger
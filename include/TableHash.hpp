@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Keyed 64-bit hash for the hash tables.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace Tiger {
+    /**
+     * A keyed 64-bit hash of the short keys for the hash tables.
+     *
+     * The Tiger compression function cut down to PASSES passes, chained from
+     * a secret key (mixed with the length) instead of the public initial
+     * state.  The keys up to 64 bytes take a single compression and there
+     * is no padding or digest serialization.  The result is the first word
+     * of the final state.
+     *
+     * Without the key, the attacker cannot craft the keys colliding in a
+     * table (hash flooding).  This is NOT a message digest nor a MAC: Use
+     * `Hash` or `Hmac` for them.
+     */
+    class TableHash {
+    public:
+        static const size_t PASSES = 2;
+
+    private:
+        const sbox_t *sbox_;
+        state_t       key_;
+
+    public:
+        /** The constructor with the per-process key (see `ProcessKey`).  */
+        TableHash () noexcept : TableHash (ProcessKey ()) { /* NO-OP */
+        }
+
+        /**
+         * The constructor.
+         *
+         * @param key  The key
+         * @param sbox The sbox
+         */
+        explicit TableHash (const state_t &key, const sbox_t &sbox = DefaultSBox ()) noexcept : sbox_ {&sbox}, key_ (key) { /* NO-OP */
+        }
+
+        /**
+         * Computes the hash of a byte sequence.
+         *
+         * @param data The bytes
+         * @param size # of bytes
+         *
+         * @return The hash
+         */
+        uint64_t operator() (const void *data, size_t size) const noexcept;
+
+        /**
+         * Computes the hash of an integer.
+         *
+         * @remarks Same as hashing its 8 bytes in little-endian.
+         * @param value The value
+         *
+         * @return The hash
+         */
+        uint64_t operator() (uint64_t value) const noexcept;
+
+        /**
+         * The key drawn from `std::random_device` at the first use in the process.
+         *
+         * @remarks The hashes differ between the runs: Do not store them.
+         */
+        static const state_t &ProcessKey () noexcept;
+    };
+
+    /**
+     * `std::hash` compatible functor on `TableHash` (with the per-process key).
+     *
+     * For example, `std::unordered_map<std::string, T, Tiger::TableHasher>`.
+     * Hashes the strings, the byte views and the integral (or enum) values.
+     */
+    struct TableHasher {
+        TableHash hash;
+
+        size_t operator() (const std::string &value) const noexcept {
+            return static_cast<size_t> (hash (value.data (), value.size ()));
+        }
+
+        size_t operator() (const ByteView &value) const noexcept { return static_cast<size_t> (hash (value.data, value.size)); }
+
+        template <typename T_, typename = typename std::enable_if<std::is_integral<T_>::value || std::is_enum<T_>::value>::type>
+        size_t operator() (T_ value) const noexcept {
+            return static_cast<size_t> (hash (static_cast<uint64_t> (value)));
+        }
+    };
+}  // namespace Tiger
@@ -17,6 +17,32 @@ namespace Tiger {
     using msgblock_t = std::array<uint64_t, 8>;
     using digest_t   = std::array<uint8_t, 3 * 8>;
 
+    /** A (non-owning) view of a byte sequence.  */
+    struct ByteView {
+        const void *data = nullptr;
+        size_t      size = 0;
+    };
+
+    /** Padding schemes.  */
+    enum class Padding {
+        Tiger1,  ///< The original Tiger (0x01)
+        Tiger2,  ///< Tiger2 (0x80, as in MD4/SHA)
+    };
+
+    /// # of bytes in the serialized `Generator` state.
+    const size_t SAVED_STATE_SIZE = 112;
+
+    /// The serialized `Generator` state (see `Generator::SaveState`).
+    using savedstate_t = std::array<uint8_t, SAVED_STATE_SIZE>;
+
+    /**
+     * Retrieves the precomputed default SBox.
+     *
+     * @remarks Identical to the one initialized by `InitializeSBox (sbox)` without its cost.
+     * @return The default SBox
+     */
+    const sbox_t &DefaultSBox () noexcept;
+
     /**
      * Initializes sbox with default configuration.
      *
@@ -38,18 +64,78 @@ namespace Tiger {
      */
     sbox_t &InitializeSBox (sbox_t &sbox, const void *seed, size_t seed_size, size_t passes) noexcept;
 
+    /**
+     * Computes the fingerprint of the SBox.
+     *
+     * @remarks Independent of the host byte order.
+     * @param sbox The SBox
+     * @return 64 bits fingerprint
+     */
+    uint64_t SBoxFingerprint (const sbox_t &sbox) noexcept;
+
+    /**
+     * Computes the Tiger192 digest of a message in one call.
+     *
+     * @remarks Same as `Generator (sbox).Update (data, size).Finalize ()` without
+     *          the intermediate buffering.  Suited for the short messages.
+     * @param sbox The sbox
+     * @param data The message
+     * @param size # of bytes in the message
+     *
+     * @return Computed digest
+     */
+    digest_t Hash (const sbox_t &sbox, const void *data, size_t size) noexcept;
+
+    /**
+     * Computes the Tiger192 digest of a message in one call with the default SBox.
+     *
+     * @param data The message
+     * @param size # of bytes in the message
+     *
+     * @return Computed digest
+     */
+    inline digest_t Hash (const void *data, size_t size) noexcept {
+        return Hash (DefaultSBox (), data, size);
+    }
+
+    /**
+     * Computes the Tiger2 digest of a message in one call.
+     *
+     * @param sbox The sbox
+     * @param data The message
+     * @param size # of bytes in the message
+     *
+     * @return Computed digest
+     */
+    digest_t Hash2 (const sbox_t &sbox, const void *data, size_t size) noexcept;
+
+    /**
+     * Computes the Tiger2 digest of a message in one call with the default SBox.
+     *
+     * @param data The message
+     * @param size # of bytes in the message
+     *
+     * @return Computed digest
+     */
+    inline digest_t Hash2 (const void *data, size_t size) noexcept {
+        return Hash2 (DefaultSBox (), data, size);
+    }
+
     /** The Tiger192 generator.  */
     class Generator {
     private:
         enum Flags { BIT_FINALIZED = 0, BIT_TIGER2 = 1 };
 
+        using compress_t = void (*) (state_t &state, const msgblock_t &input, const sbox_t &sbox, size_t passes);
+
     private:
         const sbox_t &sbox_;
         size_t        count_ = 0;
         size_t        cntPass_;
+        compress_t    compress_;  ///< Specialized for the cntPass_
         uint32_t      flags_ = 0;
         state_t       hash_;
-        msgblock_t    buffer_;
+        msgblock_t    buffer_;  ///< Pending (not yet compressed) bytes in the input order
 
     public:
         /**
@@ -84,6 +170,10 @@ namespace Tiger {
         bool IsFinalized () const { return (flags_ & (1u << BIT_FINALIZED)) != 0; }
 
         bool IsTiger2 () const { return (flags_ & (1u << BIT_TIGER2)) != 0; }
+
+        /** # of bytes fed so far.  */
+        uint64_t Count () const { return count_; }
+
         /**
          * Updates states
          *
@@ -103,6 +193,18 @@ namespace Tiger {
          */
         Generator &Update (uint8_t value) noexcept;
 
+        /**
+         * Updates states with the scattered input (as in `writev`).
+         *
+         * @remarks Blocks straddling the segments are assembled in the internal
+         *          buffer, the others are compressed straight from the segments.
+         * @param segments The input segments (in order)
+         * @param count    # of segments
+         *
+         * @return *this
+         */
+        Generator &UpdateV (const ByteView *segments, size_t count) noexcept;
+
         /**
          * Computes Tiger192 digest
          *
@@ -110,5 +212,191 @@ namespace Tiger {
          * @return Computed digest
          */
         digest_t Finalize () noexcept;
+
+        /**
+         * Computes the digest of the bytes fed so far without finalizing.
+         *
+         * @remarks Costs the final 1 or 2 blocks.  The generator can be updated afterwards.
+         * @return The digest (same as the one `Finalize ()` would return now)
+         */
+        digest_t Peek () const noexcept;
+
+        /**
+         * Serializes the current state.
+         *
+         * @remarks The result is versioned and independent of the host byte order,
+         *          so it can be restored by another process or on another host.
+         *          It carries the fingerprint of the SBox in use.
+         * @return The serialized state
+         */
+        savedstate_t SaveState () const noexcept;
+
+        /**
+         * Restores the state saved by `SaveState`.
+         *
+         * @remarks The # of passes and the padding scheme are taken from STATE.
+         *          Leaves the generator untouched on failure.
+         * @param state The serialized state
+         * @return false if STATE is malformed, of an unknown version or made with a different SBox
+         */
+        bool RestoreState (const savedstate_t &state) noexcept;
     };
+
+    /**
+     * The Tiger192 generator with the # of passes and the padding fixed at the compile time.
+     *
+     * The compression function is fully unrolled for each instantiation.
+     * Instantiated for 3, 4, 6 and 8 passes (`Generator` dispatches to
+     * these for the matching pass counts).
+     */
+    template <size_t PASSES_, Padding PADDING_ = Padding::Tiger1>
+    class BasicGenerator {
+    private:
+        const sbox_t &sbox_;
+        size_t        count_     = 0;
+        bool          finalized_ = false;
+        state_t       hash_;
+        msgblock_t    buffer_;  ///< Pending (not yet compressed) bytes in the input order
+
+    public:
+        static constexpr size_t  PASSES  = PASSES_;
+        static constexpr Padding PADDING = PADDING_;
+
+        /**
+         * The constructor.
+         *
+         * @param sbox The sbox
+         */
+        explicit BasicGenerator (const sbox_t &sbox) noexcept;
+
+        /** Resets the state.  */
+        BasicGenerator &Reset () noexcept;
+
+        bool IsFinalized () const { return finalized_; }
+
+        /**
+         * Updates states
+         *
+         * @param data   The input sequence
+         * @param size   # of bytes in the input sequence
+         *
+         * @return *this
+         */
+        BasicGenerator &Update (const void *data, size_t size) noexcept;
+
+        /**
+         * Updates states
+         *
+         * @param value  The input value
+         *
+         * @return *this
+         */
+        BasicGenerator &Update (uint8_t value) noexcept;
+
+        /**
+         * Updates states with the scattered input (as in `writev`).
+         *
+         * @param segments The input segments (in order)
+         * @param count    # of segments
+         *
+         * @return *this
+         */
+        BasicGenerator &UpdateV (const ByteView *segments, size_t count) noexcept;
+
+        /**
+         * Computes Tiger192 digest
+         *
+         * @remarks Once finalized, successive Finalize() returns the same value.
+         * @return Computed digest
+         */
+        digest_t Finalize () noexcept;
+
+        /**
+         * Computes the digest of the bytes fed so far without finalizing.
+         *
+         * @return The digest (same as the one `Finalize ()` would return now)
+         */
+        digest_t Peek () const noexcept;
+    };
+
+    /**
+     * The Tiger192 hashing context as a plain value.
+     *
+     * Same as `Generator` except that the SBox is supplied to each call
+     * (or the `DefaultSBox ()` is used).  Holding no reference, it is
+     * trivially copyable and assignable: It can be kept in the reused
+     * arrays, the pools (see `ContextPool`) and the shared memory, and be
+     * relocated by `memcpy`.
+     *
+     * @remarks The default constructed context is indeterminate.  Call `Reset` first.
+     *          Supply the same SBox to every call on a stream.
+     */
+    struct Context {
+        state_t    hash;
+        msgblock_t buffer;    ///< Pending (not yet compressed) bytes in the input order
+        uint64_t   count;     ///< # of bytes fed so far
+        uint16_t   passes;    ///< # of iterations in the compression function
+        uint16_t   flags;     ///< Finalized (bit 0) and Tiger2 padding (bit 1)
+        uint32_t   reserved;  ///< Always 0
+
+        /**
+         * Starts a new stream.
+         *
+         * @param cntPass # of iterations in the compression function
+         * @param padding The padding scheme
+         *
+         * @return *this
+         */
+        Context &Reset (size_t cntPass = DEFAULT_PASSES, Padding padding = Padding::Tiger1) noexcept;
+
+        bool IsFinalized () const { return (flags & 1u) != 0; }
+
+        bool IsTiger2 () const { return (flags & 2u) != 0; }
+
+        /**
+         * Updates states
+         *
+         * @param sbox The sbox
+         * @param data The input sequence
+         * @param size # of bytes in the input sequence
+         *
+         * @return *this
+         */
+        Context &Update (const sbox_t &sbox, const void *data, size_t size) noexcept;
+
+        /** Updates states with the default SBox.  */
+        Context &Update (const void *data, size_t size) noexcept { return Update (DefaultSBox (), data, size); }
+
+        /**
+         * Computes Tiger192 digest
+         *
+         * @remarks Once finalized, successive Finalize() returns the same value.
+         * @param sbox The sbox
+         * @return Computed digest
+         */
+        digest_t Finalize (const sbox_t &sbox) noexcept;
+
+        /** Computes Tiger192 digest with the default SBox.  */
+        digest_t Finalize () noexcept { return Finalize (DefaultSBox ()); }
+
+        /**
+         * Computes the digest of the bytes fed so far without finalizing.
+         *
+         * @param sbox The sbox
+         * @return The digest (same as the one `Finalize (sbox)` would return now)
+         */
+        digest_t Peek (const sbox_t &sbox) const noexcept;
+
+        /** Computes the digest of the bytes fed so far with the default SBox.  */
+        digest_t Peek () const noexcept { return Peek (DefaultSBox ()); }
+    };
+
+    extern template class BasicGenerator<3, Padding::Tiger1>;
+    extern template class BasicGenerator<4, Padding::Tiger1>;
+    extern template class BasicGenerator<6, Padding::Tiger1>;
+    extern template class BasicGenerator<8, Padding::Tiger1>;
+    extern template class BasicGenerator<3, Padding::Tiger2>;
+    extern template class BasicGenerator<4, Padding::Tiger2>;
+    extern template class BasicGenerator<6, Padding::Tiger2>;
+    extern template class BasicGenerator<8, Padding::Tiger2>;
 }  // namespace Tiger
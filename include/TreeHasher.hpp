@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Tiger Tree Hash (THEX).
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Tiger {
+    namespace internal {
+        class ThreadPool;
+    }
+
+    /**
+     * The Tiger Tree Hash (THEX / TTH) generator.
+     *
+     * The message is split into 1024 bytes leaves hashed as `Tiger (0x00 || leaf)`
+     * and the internal nodes are `Tiger (0x01 || left || right)`.  A node without
+     * a sibling is promoted to the upper level as is.
+     *
+     * Leaves are hashed on a thread pool in aligned chunks, each reduced to a
+     * complete subtree by its worker.  The subtrees are merged incrementally,
+     * so the memory use does not depend on the message length.
+     */
+    class TreeHasher {
+    public:
+        static const size_t LEAF_SIZE = 1024;
+        /// Specifies no levels to be recorded.
+        static const size_t NO_LEVELS = ~static_cast<size_t> (0);
+
+    private:
+        struct Node {
+            digest_t digest;
+            size_t   height;
+        };
+
+        const sbox_t                          &sbox_;
+        std::unique_ptr<internal::ThreadPool> pool_;
+        size_t                                recordLevel_;
+        uint64_t                              cntLeaf_    = 0;
+        size_t                                cntPending_ = 0;
+        bool                                  finalized_  = false;
+        digest_t                              root_;
+        std::vector<Node>                     stack_;
+        std::vector<digest_t>                 recorded_;
+        std::array<uint8_t, LEAF_SIZE>        pending_;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param sbox The sbox
+         */
+        explicit TreeHasher (const sbox_t &sbox) : TreeHasher (sbox, 0, NO_LEVELS) { /* NO-OP */
+        }
+
+        /**
+         * The constructor with the explicit # of threads.
+         *
+         * @param sbox        The sbox
+         * @param cntThread   # of threads to hash the leaves.  0 uses all hardware threads.
+         * @param recordLevel The lowest tree level (0: leaves) retained for `Levels ()`
+         */
+        TreeHasher (const sbox_t &sbox, size_t cntThread, size_t recordLevel);
+
+        TreeHasher (const TreeHasher &) = delete;
+        TreeHasher &operator= (const TreeHasher &) = delete;
+
+        ~TreeHasher ();
+
+        /** Resets the state.  */
+        TreeHasher &Reset () noexcept;
+
+        bool IsFinalized () const { return finalized_; }
+
+        /**
+         * Updates states
+         *
+         * @param data   The input sequence
+         * @param size   # of bytes in the input sequence
+         *
+         * @return *this
+         */
+        TreeHasher &Update (const void *data, size_t size);
+
+        /**
+         * Computes the root hash.
+         *
+         * @remarks Once finalized, successive Finalize() returns the same value.
+         * @return The root hash
+         */
+        digest_t Finalize ();
+
+        /**
+         * Retrieves the tree levels from the root down to the recorded level.
+         *
+         * @remarks Requires `Finalize ()`.
+         * @return Levels (`[0]` holds the root alone)
+         */
+        std::vector<std::vector<digest_t>> Levels () const;
+
+        /** # of leaves consumed so far.  */
+        uint64_t LeafCount () const { return cntLeaf_; }
+
+        /**
+         * Computes the hash of a leaf.
+         *
+         * @param data The leaf
+         * @param size # of bytes in the leaf (<= LEAF_SIZE)
+         *
+         * @return The leaf hash
+         */
+        digest_t HashLeaf (const void *data, size_t size) const noexcept;
+
+        /**
+         * Computes the hash of an internal node.
+         *
+         * @param left  The left child
+         * @param right The right child
+         *
+         * @return The node hash
+         */
+        digest_t HashNode (const digest_t &left, const digest_t &right) const noexcept;
+
+    private:
+        void Push (const digest_t &digest, size_t height);
+        void HashLeaves (const uint8_t *data, size_t cntLeaf);
+    };
+}  // namespace Tiger
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/**
+ * @file
+ * @brief The C interface of the Tiger hash.
+ *
+ * The stable ABI for C and for the foreign function interfaces (ctypes,
+ * cffi, ...).  The entry points never throw and never allocate except in
+ * `tiger_hash_batch` with the threads.  The layouts of the structs only
+ * grow along with TIGER_ABI_VERSION.
+ */
+#ifndef TIGER_H_
+#define TIGER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#    if defined(TIGER_BUILDING_SHARED)
+#        define TIGER_API __declspec (dllexport)
+#    elif defined(TIGER_SHARED)
+#        define TIGER_API __declspec (dllimport)
+#    else
+#        define TIGER_API
+#    endif
+#elif defined(__GNUC__) || defined(__clang__)
+#    define TIGER_API __attribute__ ((visibility ("default")))
+#else
+#    define TIGER_API
+#endif
+
+#define TIGER_ABI_VERSION    1
+#define TIGER_DIGEST_SIZE    24
+#define TIGER_DEFAULT_PASSES 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Padding schemes.  */
+typedef enum tiger_padding {
+    TIGER_PADDING_TIGER1 = 0, /**< The original Tiger (0x01) */
+    TIGER_PADDING_TIGER2 = 1, /**< Tiger2 (0x80, as in MD4/SHA) */
+} tiger_padding;
+
+/** Results of the entry points.  */
+typedef enum tiger_status {
+    TIGER_OK              = 0,
+    TIGER_ERROR_ARGUMENT  = 1, /**< Invalid argument */
+    TIGER_ERROR_RESOURCES = 2, /**< Out of memory or threads */
+} tiger_status;
+
+/**
+ * The hashing context of a stream.
+ *
+ * Plain old data of a fixed size: Place it anywhere (on the stack, in
+ * the arrays or in the shared memory) and copy it by `memcpy`.
+ */
+typedef struct tiger_ctx {
+    uint64_t opaque[13];
+} tiger_ctx;
+
+/** A (non-owning) view of a byte sequence.  */
+typedef struct tiger_view {
+    const void *data;
+    size_t      size;
+} tiger_view;
+
+/** TIGER_ABI_VERSION of the library (may be newer than the header).  */
+TIGER_API unsigned tiger_abi_version (void);
+
+/**
+ * Computes the Tiger digest (3 passes, the original padding).
+ *
+ * @param data   The message
+ * @param size   # of bytes in the message
+ * @param digest Receives TIGER_DIGEST_SIZE bytes
+ */
+TIGER_API void tiger_hash (const void *data, size_t size, uint8_t *digest);
+
+/** Computes the Tiger2 digest (3 passes, the MD4/SHA padding).  */
+TIGER_API void tiger2_hash (const void *data, size_t size, uint8_t *digest);
+
+/**
+ * Computes the digest with the # of passes and the padding.
+ *
+ * @param data    The message
+ * @param size    # of bytes in the message
+ * @param passes  # of iterations in the compression function (0 for TIGER_DEFAULT_PASSES)
+ * @param padding The padding scheme
+ * @param digest  Receives TIGER_DIGEST_SIZE bytes
+ *
+ * @return TIGER_OK or TIGER_ERROR_ARGUMENT
+ */
+TIGER_API int tiger_hash_ex (const void *data, size_t size, unsigned passes, tiger_padding padding, uint8_t *digest);
+
+/**
+ * Starts a new stream.
+ *
+ * @param ctx     The context
+ * @param passes  # of iterations in the compression function (0 for TIGER_DEFAULT_PASSES)
+ * @param padding The padding scheme
+ *
+ * @return TIGER_OK or TIGER_ERROR_ARGUMENT
+ */
+TIGER_API int tiger_ctx_init (tiger_ctx *ctx, unsigned passes, tiger_padding padding);
+
+/** Feeds the bytes of the stream.  */
+TIGER_API void tiger_ctx_update (tiger_ctx *ctx, const void *data, size_t size);
+
+/** Computes the digest of the bytes fed so far (the stream continues).  */
+TIGER_API void tiger_ctx_peek (const tiger_ctx *ctx, uint8_t *digest);
+
+/** Computes the digest of the stream (successive calls return the same digest).  */
+TIGER_API void tiger_ctx_final (tiger_ctx *ctx, uint8_t *digest);
+
+/**
+ * Computes the digests of many messages.
+ *
+ * The messages are hashed in the interleaved lanes of the best kernel
+ * available (and spread over the threads).
+ *
+ * @param digests  Receives COUNT * TIGER_DIGEST_SIZE bytes
+ * @param inputs   The messages
+ * @param count    # of messages
+ * @param passes   # of iterations in the compression function (0 for TIGER_DEFAULT_PASSES)
+ * @param padding  The padding scheme
+ * @param nthreads # of threads (0 uses all hardware threads)
+ *
+ * @return TIGER_OK, TIGER_ERROR_ARGUMENT or TIGER_ERROR_RESOURCES
+ */
+TIGER_API int tiger_hash_batch (uint8_t *digests, const tiger_view *inputs, size_t count, unsigned passes, tiger_padding padding, size_t nthreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIGER_H_ */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "tiger.h"
+
+#include "HashBatch.hpp"
+#include "Tiger.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace {
+    using Tiger::Context;
+
+    static_assert (sizeof (Context) == sizeof (tiger_ctx), "tiger_ctx should hold a Context");
+    static_assert (alignof (Context) <= alignof (tiger_ctx), "tiger_ctx should align a Context");
+    static_assert (std::is_trivially_copyable<Context>::value, "Context should be relocatable");
+    static_assert (sizeof (Tiger::ByteView) == sizeof (tiger_view)
+                       && offsetof (Tiger::ByteView, data) == offsetof (tiger_view, data)
+                       && offsetof (Tiger::ByteView, size) == offsetof (tiger_view, size),
+                   "tiger_view should be laid out as Tiger::ByteView");
+    static_assert (sizeof (Tiger::digest_t) == TIGER_DIGEST_SIZE, "Digest size mismatch");
+    static_assert (Tiger::DEFAULT_PASSES == TIGER_DEFAULT_PASSES, "Default passes mismatch");
+
+    bool to_options (unsigned passes, tiger_padding padding, size_t &cntPass, Tiger::Padding &result) noexcept {
+        switch (padding) {
+        case TIGER_PADDING_TIGER1: result = Tiger::Padding::Tiger1; break;
+        case TIGER_PADDING_TIGER2: result = Tiger::Padding::Tiger2; break;
+        default: return false;
+        }
+        cntPass = passes == 0 ? Tiger::DEFAULT_PASSES : passes;
+        return Tiger::DEFAULT_PASSES <= cntPass && cntPass <= 0xFFFFu;
+    }
+
+    Context &context_of (tiger_ctx *ctx) noexcept {
+        return *reinterpret_cast<Context *> (ctx);
+    }
+
+    const Context &context_of (const tiger_ctx *ctx) noexcept {
+        return *reinterpret_cast<const Context *> (ctx);
+    }
+
+    void store (uint8_t *result, const Tiger::digest_t &digest) noexcept {
+        ::memcpy (result, digest.data (), digest.size ());
+    }
+}  // namespace
+
+unsigned tiger_abi_version (void) {
+    return TIGER_ABI_VERSION;
+}
+
+void tiger_hash (const void *data, size_t size, uint8_t *digest) {
+    store (digest, Tiger::Hash (data, size));
+}
+
+void tiger2_hash (const void *data, size_t size, uint8_t *digest) {
+    store (digest, Tiger::Hash2 (data, size));
+}
+
+int tiger_hash_ex (const void *data, size_t size, unsigned passes, tiger_padding padding, uint8_t *digest) {
+    size_t         cntPass;
+    Tiger::Padding pad;
+    if (! to_options (passes, padding, cntPass, pad)) {
+        return TIGER_ERROR_ARGUMENT;
+    }
+    if (cntPass == Tiger::DEFAULT_PASSES) {
+        store (digest, pad == Tiger::Padding::Tiger2 ? Tiger::Hash2 (data, size) : Tiger::Hash (data, size));
+    }
+    else {
+        Tiger::Generator gen (Tiger::DefaultSBox (), cntPass, pad == Tiger::Padding::Tiger2);
+        store (digest, gen.Update (data, size).Finalize ());
+    }
+    return TIGER_OK;
+}
+
+int tiger_ctx_init (tiger_ctx *ctx, unsigned passes, tiger_padding padding) {
+    size_t         cntPass;
+    Tiger::Padding pad;
+    if (ctx == nullptr || ! to_options (passes, padding, cntPass, pad)) {
+        return TIGER_ERROR_ARGUMENT;
+    }
+    context_of (ctx).Reset (cntPass, pad);
+    return TIGER_OK;
+}
+
+void tiger_ctx_update (tiger_ctx *ctx, const void *data, size_t size) {
+    context_of (ctx).Update (data, size);
+}
+
+void tiger_ctx_peek (const tiger_ctx *ctx, uint8_t *digest) {
+    store (digest, context_of (ctx).Peek ());
+}
+
+void tiger_ctx_final (tiger_ctx *ctx, uint8_t *digest) {
+    store (digest, context_of (ctx).Finalize ());
+}
+
+int tiger_hash_batch (uint8_t *digests, const tiger_view *inputs, size_t count, unsigned passes, tiger_padding padding, size_t nthreads) {
+    Tiger::HashBatchOptions options;
+    if ((0 < count && (digests == nullptr || inputs == nullptr)) || ! to_options (passes, padding, options.passes, options.padding)) {
+        return TIGER_ERROR_ARGUMENT;
+    }
+    options.cntThread = nthreads;
+    try {
+        // digest_t is a byte array: The results go straight into DIGESTS.
+        static_assert (sizeof (Tiger::digest_t[2]) == 2 * TIGER_DIGEST_SIZE, "Digests should be packed");
+        Tiger::HashBatch (reinterpret_cast<Tiger::digest_t *> (digests), reinterpret_cast<const Tiger::ByteView *> (inputs), count, options);
+    }
+    catch (...) {
+        // std::bad_alloc, std::system_error from the threads or anything else: Never unwinds into C.
+        return TIGER_ERROR_RESOURCES;
+    }
+    return TIGER_OK;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "ChunkStore.hpp"
+
+#include "HashBatch.hpp"
+
+#include <utility>
+
+namespace Tiger {
+    ChunkStore::ChunkStore (const ChunkStoreOptions &options)
+            : chunker_ {options.chunker}
+            , index_ {options.capacity}
+            , cntThread_ {options.cntThread} {
+        /* NO-OP */
+    }
+
+    ChunkStore::ChunkStore (DigestIndex index, const ChunkStoreOptions &options)
+            : chunker_ {options.chunker}
+            , index_ {std::move (index)}
+            , cntThread_ {options.cntThread} {
+        index_.Reserve (options.capacity);
+    }
+
+    size_t ChunkStore::Ingest (const void *data, size_t size, bool isLast, std::vector<ChunkRef> &result) {
+        auto const *p = static_cast<const uint8_t *> (data);
+
+        std::vector<ByteView> chunks;
+        size_t                consumed = 0;
+        while (consumed < size) {
+            auto n = chunker_.Next (p + consumed, size - consumed);
+            if (! isLast && consumed + n == size && n < chunker_.MaxSize ()) {
+                break;  // May continue in the following bytes
+            }
+            chunks.push_back (ByteView {p + consumed, n});
+            consumed += n;
+        }
+        std::vector<digest_t> digests (chunks.size ());
+        HashBatchOptions      options;
+        options.cntThread = cntThread_;
+        HashBatch (digests.data (), chunks.data (), chunks.size (), options);
+
+        result.reserve (result.size () + chunks.size ());
+        for (size_t i = 0; i < chunks.size (); ++i) {
+            auto const inserted = index_.Insert (digests[i], index_.Size ());
+
+            ChunkRef ref;
+            ref.digest = digests[i];
+            ref.id     = inserted.first;
+            ref.offset = offset_;
+            ref.size   = static_cast<uint32_t> (chunks[i].size);
+            ref.isNew  = inserted.second;
+            result.push_back (ref);
+            offset_ += chunks[i].size;
+        }
+        return consumed;
+    }
+}  // namespace Tiger
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Chunker.hpp"
+
+#include <algorithm>
+
+namespace Tiger {
+    namespace {
+        /// log2 of the largest power of 2 not exceeding the VALUE (>= 1).
+        size_t floor_log2 (size_t value) noexcept {
+            size_t result = 0;
+            while (1 < (value >> result)) {
+                ++result;
+            }
+            return result;
+        }
+
+        /// Mask selecting the upper CNT bits.
+        uint64_t upper_bits (size_t cnt) noexcept {
+            cnt = std::min<size_t> (std::max<size_t> (1, cnt), 63);
+            return ~static_cast<uint64_t> (0) << (64 - cnt);
+        }
+
+        /// Clamps the SIZE into [1, MAX_CHUNK_SIZE].
+        size_t clamp_size (size_t size) noexcept {
+            return std::min<size_t> (std::max<size_t> (1, size), Chunker::MAX_CHUNK_SIZE);
+        }
+    }  // namespace
+
+    const size_t Chunker::MAX_CHUNK_SIZE;
+
+    Chunker::Chunker (const ChunkerOptions &options) noexcept
+            : minSize_ {clamp_size (options.minSize)}
+            , avgSize_ {static_cast<size_t> (1) << floor_log2 (clamp_size (std::max (minSize_, options.avgSize)))}
+            , maxSize_ {clamp_size (std::max (avgSize_, options.maxSize))} {
+        auto const bits = floor_log2 (avgSize_);
+        maskSmall_      = upper_bits (bits + 2);
+        maskLarge_      = upper_bits (bits - 2);
+    }
+
+    size_t Chunker::Next (const void *data, size_t size) const noexcept {
+        if (size <= minSize_) {
+            return size;
+        }
+        auto const &gear   = DefaultSBox ();
+        auto const *p      = static_cast<const uint8_t *> (data);
+        size_t      limit  = std::min (size, maxSize_);
+        size_t      normal = std::min (limit, avgSize_);
+
+        uint64_t h = 0;
+        size_t   i = minSize_;
+        for (; i < normal; ++i) {
+            h = (h << 1u) + gear[p[i]];
+            if ((h & maskSmall_) == 0) {
+                return i + 1;
+            }
+        }
+        for (; i < limit; ++i) {
+            h = (h << 1u) + gear[p[i]];
+            if ((h & maskLarge_) == 0) {
+                return i + 1;
+            }
+        }
+        return limit;
+    }
+}  // namespace Tiger
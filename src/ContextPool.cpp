@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "ContextPool.hpp"
+
+namespace Tiger {
+    const size_t ContextPool::SLAB_SIZE;
+
+    ContextPool::ContextPool (size_t capacity) {
+        size_t cntSlab = (capacity + SLAB_SIZE - 1) / SLAB_SIZE;
+        free_.reserve (SLAB_SIZE * cntSlab);
+        for (size_t i = 0; i < cntSlab; ++i) {
+            slabs_.emplace_back (new Context[SLAB_SIZE]);
+            for (size_t k = 0; k < SLAB_SIZE; ++k) {
+                free_.emplace_back (&slabs_.back ()[SLAB_SIZE - 1 - k]);
+            }
+        }
+        cntCarved_ = SLAB_SIZE;
+    }
+
+    Context *ContextPool::Acquire (size_t cntPass, Padding padding) {
+        Context *result;
+        if (! free_.empty ()) {
+            result = free_.back ();
+            free_.pop_back ();
+        }
+        else {
+            if (slabs_.empty () || cntCarved_ == SLAB_SIZE) {
+                slabs_.emplace_back (new Context[SLAB_SIZE]);
+                cntCarved_ = 0;
+                // Makes the room for all the contexts released back (`Release` never allocates).
+                free_.reserve (Capacity ());
+            }
+            result = &slabs_.back ()[cntCarved_++];
+        }
+        ++cntInUse_;
+        return &result->Reset (cntPass, padding);
+    }
+
+    void ContextPool::Release (Context *context) noexcept {
+        free_.push_back (context);
+        --cntInUse_;
+    }
+}  // namespace Tiger
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Tiger.hpp"
+
+namespace Tiger {
+    namespace {
+        /**
+         * The default SBox (as computed by `InitializeSBox (sbox)`).
+         *
+         * Stored as a constant so no process has to pay for the ~1700
+         * compressions of the initialization.  test/sbox.cpp checks both
+         * agree.
+         */
+        // clang-format off
+        const sbox_t default_sbox {{
+        // T1
+        0x02AAB17CF7E90C5EuLL, 0xAC424B03E243A8ECuLL, 0x72CD5BE30DD5FCD3uLL,
+        0x6D019B93F6F97F3AuLL, 0xCD9978FFD21F9193uLL, 0x7573A1C9708029E2uLL,
+        0xB164326B922A83C3uLL, 0x46883EEE04915870uLL, 0xEAACE3057103ECE6uLL,
+        0xC54169B808A3535CuLL, 0x4CE754918DDEC47CuLL, 0x0AA2F4DFDC0DF40CuLL,
+        0x10B76F18A74DBEFAuLL, 0xC6CCB6235AD1AB6AuLL, 0x13726121572FE2FFuLL,
+        0x1A488C6F199D921EuLL, 0x4BC9F9F4DA0007CAuLL, 0x26F5E6F6E85241C7uLL,
+        0x859079DBEA5947B6uLL, 0x4F1885C5C99E8C92uLL, 0xD78E761EA96F864BuLL,
+        0x8E36428C52B5C17DuLL, 0x69CF6827373063C1uLL, 0xB607C93D9BB4C56EuLL,
+        0x7D820E760E76B5EAuLL, 0x645C9CC6F07FDC42uLL, 0xBF38A078243342E0uLL,
+        0x5F6B343C9D2E7D04uLL, 0xF2C28AEB600B0EC6uLL, 0x6C0ED85F7254BCACuLL,
+        0x71592281A4DB4FE5uLL, 0x1967FA69CE0FED9FuLL, 0xFD5293F8B96545DBuLL,
+        0xC879E9D7F2A7600BuLL, 0x860248920193194EuLL, 0xA4F9533B2D9CC0B3uLL,
+        0x9053836C15957613uLL, 0xDB6DCF8AFC357BF1uLL, 0x18BEEA7A7A370F57uLL,
+        0x037117CA50B99066uLL, 0x6AB30A9774424A35uLL, 0xF4E92F02E325249BuLL,
+        0x7739DB07061CCAE1uLL, 0xD8F3B49CECA42A05uLL, 0xBD56BE3F51382F73uLL,
+        0x45FAED5843B0BB28uLL, 0x1C813D5C11BF1F83uLL, 0x8AF0E4B6D75FA169uLL,
+        0x33EE18A487AD9999uLL, 0x3C26E8EAB1C94410uLL, 0xB510102BC0A822F9uLL,
+        0x141EEF310CE6123BuLL, 0xFC65B90059DDB154uLL, 0xE0158640C5E0E607uLL,
+        0x884E079826C3A3CFuLL, 0x930D0D9523C535FDuLL, 0x35638D754E9A2B00uLL,
+        0x4085FCCF40469DD5uLL, 0xC4B17AD28BE23A4CuLL, 0xCAB2F0FC6A3E6A2EuLL,
+        0x2860971A6B943FCDuLL, 0x3DDE6EE212E30446uLL, 0x6222F32AE01765AEuLL,
+        0x5D550BB5478308FEuLL, 0xA9EFA98DA0EDA22AuLL, 0xC351A71686C40DA7uLL,
+        0x1105586D9C867C84uLL, 0xDCFFEE85FDA22853uLL, 0xCCFBD0262C5EEF76uLL,
+        0xBAF294CB8990D201uLL, 0xE69464F52AFAD975uLL, 0x94B013AFDF133E14uLL,
+        0x06A7D1A32823C958uLL, 0x6F95FE5130F61119uLL, 0xD92AB34E462C06C0uLL,
+        0xED7BDE33887C71D2uLL, 0x79746D6E6518393EuLL, 0x5BA419385D713329uLL,
+        0x7C1BA6B948A97564uLL, 0x31987C197BFDAC67uLL, 0xDE6C23C44B053D02uLL,
+        0x581C49FED002D64DuLL, 0xDD474D6338261571uLL, 0xAA4546C3E473D062uLL,
+        0x928FCE349455F860uLL, 0x48161BBACAAB94D9uLL, 0x63912430770E6F68uLL,
+        0x6EC8A5E602C6641CuLL, 0x87282515337DDD2BuLL, 0x2CDA6B42034B701BuLL,
+        0xB03D37C181CB096DuLL, 0xE108438266C71C6FuLL, 0x2B3180C7EB51B255uLL,
+        0xDF92B82F96C08BBCuLL, 0x5C68C8C0A632F3BAuLL, 0x5504CC861C3D0556uLL,
+        0xABBFA4E55FB26B8FuLL, 0x41848B0AB3BACEB4uLL, 0xB334A273AA445D32uLL,
+        0xBCA696F0A85AD881uLL, 0x24F6EC65B528D56CuLL, 0x0CE1512E90F4524AuLL,
+        0x4E9DD79D5506D35AuLL, 0x258905FAC6CE9779uLL, 0x2019295B3E109B33uLL,
+        0xF8A9478B73A054CCuLL, 0x2924F2F934417EB0uLL, 0x3993357D536D1BC4uLL,
+        0x38A81AC21DB6FF8BuLL, 0x47C4FBF17D6016BFuLL, 0x1E0FAADD7667E3F5uLL,
+        0x7ABCFF62938BEB96uLL, 0xA78DAD948FC179C9uLL, 0x8F1F98B72911E50DuLL,
+        0x61E48EAE27121A91uLL, 0x4D62F7AD31859808uLL, 0xECEBA345EF5CEAEBuLL,
+        0xF5CEB25EBC9684CEuLL, 0xF633E20CB7F76221uLL, 0xA32CDF06AB8293E4uLL,
+        0x985A202CA5EE2CA4uLL, 0xCF0B8447CC8A8FB1uLL, 0x9F765244979859A3uLL,
+        0xA8D516B1A1240017uLL, 0x0BD7BA3EBB5DC726uLL, 0xE54BCA55B86ADB39uLL,
+        0x1D7A3AFD6C478063uLL, 0x519EC608E7669EDDuLL, 0x0E5715A2D149AA23uLL,
+        0x177D4571848FF194uLL, 0xEEB55F3241014C22uLL, 0x0F5E5CA13A6E2EC2uLL,
+        0x8029927B75F5C361uLL, 0xAD139FABC3D6E436uLL, 0x0D5DF1A94CCF402FuLL,
+        0x3E8BD948BEA5DFC8uLL, 0xA5A0D357BD3FF77EuLL, 0xA2D12E251F74F645uLL,
+        0x66FD9E525E81A082uLL, 0x2E0C90CE7F687A49uLL, 0xC2E8BCBEBA973BC5uLL,
+        0x000001BCE509745FuLL, 0x423777BBE6DAB3D6uLL, 0xD1661C7EAEF06EB5uLL,
+        0xA1781F354DAACFD8uLL, 0x2D11284A2B16AFFCuLL, 0xF1FC4F67FA891D1FuLL,
+        0x73ECC25DCB920ADAuLL, 0xAE610C22C2A12651uLL, 0x96E0A810D356B78AuLL,
+        0x5A9A381F2FE7870FuLL, 0xD5AD62EDE94E5530uLL, 0xD225E5E8368D1427uLL,
+        0x65977B70C7AF4631uLL, 0x99F889B2DE39D74FuLL, 0x233F30BF54E1D143uLL,
+        0x9A9675D3D9A63C97uLL, 0x5470554FF334F9A8uLL, 0x166ACB744A4F5688uLL,
+        0x70C74CAAB2E4AEADuLL, 0xF0D091646F294D12uLL, 0x57B82A89684031D1uLL,
+        0xEFD95A5A61BE0B6BuLL, 0x2FBD12E969F2F29AuLL, 0x9BD37013FEFF9FE8uLL,
+        0x3F9B0404D6085A06uLL, 0x4940C1F3166CFE15uLL, 0x09542C4DCDF3DEFBuLL,
+        0xB4C5218385CD5CE3uLL, 0xC935B7DC4462A641uLL, 0x3417F8A68ED3B63FuLL,
+        0xB80959295B215B40uLL, 0xF99CDAEF3B8C8572uLL, 0x018C0614F8FCB95DuLL,
+        0x1B14ACCD1A3ACDF3uLL, 0x84D471F200BB732DuLL, 0xC1A3110E95E8DA16uLL,
+        0x430A7220BF1A82B8uLL, 0xB77E090D39DF210EuLL, 0x5EF4BD9F3CD05E9DuLL,
+        0x9D4FF6DA7E57A444uLL, 0xDA1D60E183D4A5F8uLL, 0xB287C38417998E47uLL,
+        0xFE3EDC121BB31886uLL, 0xC7FE3CCC980CCBEFuLL, 0xE46FB590189BFD03uLL,
+        0x3732FD469A4C57DCuLL, 0x7EF700A07CF1AD65uLL, 0x59C64468A31D8859uLL,
+        0x762FB0B4D45B61F6uLL, 0x155BAED099047718uLL, 0x68755E4C3D50BAA6uLL,
+        0xE9214E7F22D8B4DFuLL, 0x2ADDBF532EAC95F4uLL, 0x32AE3909B4BD0109uLL,
+        0x834DF537B08E3450uLL, 0xFA209DA84220728DuLL, 0x9E691D9B9EFE23F7uLL,
+        0x0446D288C4AE8D7FuLL, 0x7B4CC524E169785BuLL, 0x21D87F0135CA1385uLL,
+        0xCEBB400F137B8AA5uLL, 0x272E2B66580796BEuLL, 0x3612264125C2B0DEuLL,
+        0x057702BDAD1EFBB2uLL, 0xD4BABB8EACF84BE9uLL, 0x91583139641BC67BuLL,
+        0x8BDC2DE08036E024uLL, 0x603C8156F49F68EDuLL, 0xF7D236F7DBEF5111uLL,
+        0x9727C4598AD21E80uLL, 0xA08A0896670A5FD7uLL, 0xCB4A8F4309EBA9CBuLL,
+        0x81AF564B0F7036A1uLL, 0xC0B99AA778199ABDuLL, 0x959F1EC83FC8E952uLL,
+        0x8C505077794A81B9uLL, 0x3ACAAF8F056338F0uLL, 0x07B43F50627A6778uLL,
+        0x4A44AB49F5ECCC77uLL, 0x3BC3D6E4B679EE98uLL, 0x9CC0D4D1CF14108CuLL,
+        0x4406C00B206BC8A0uLL, 0x82A18854C8D72D89uLL, 0x67E366B35C3C432CuLL,
+        0xB923DD61102B37F2uLL, 0x56AB2779D884271DuLL, 0xBE83E1B0FF1525AFuLL,
+        0xFB7C65D4217E49A9uLL, 0x6BDBE0E76D48E7D4uLL, 0x08DF828745D9179EuLL,
+        0x22EA6A9ADD53BD34uLL, 0xE36E141C5622200AuLL, 0x7F805D1B8CB750EEuLL,
+        0xAFE5C7A59F58E837uLL, 0xE27F996A4FB1C23CuLL, 0xD3867DFB0775F0D0uLL,
+        0xD0E673DE6E88891AuLL, 0x123AEB9EAFB86C25uLL, 0x30F1D5D5C145B895uLL,
+        0xBB434A2DEE7269E7uLL, 0x78CB67ECF931FA38uLL, 0xF33B0372323BBF9CuLL,
+        0x52D66336FB279C74uLL, 0x505F33AC0AFB4EAAuLL, 0xE8A5CD99A2CCE187uLL,
+        0x534974801E2D30BBuLL, 0x8D2D5711D5876D90uLL, 0x1F1A412891BC038EuLL,
+        0xD6E2E71D82E56648uLL, 0x74036C3A497732B7uLL, 0x89B67ED96361F5ABuLL,
+        0xFFED95D8F1EA02A2uLL, 0xE72B3BD61464D43DuLL, 0xA6300F170BDC4820uLL,
+        0xEBC18760ED78A77AuLL,
+        // T2
+        0xE6A6BE5A05A12138uLL, 0xB5A122A5B4F87C98uLL, 0x563C6089140B6990uLL,
+        0x4C46CB2E391F5DD5uLL, 0xD932ADDBC9B79434uLL, 0x08EA70E42015AFF5uLL,
+        0xD765A6673E478CF1uLL, 0xC4FB757EAB278D99uLL, 0xDF11C6862D6E0692uLL,
+        0xDDEB84F10D7F3B16uLL, 0x6F2EF604A665EA04uLL, 0x4A8E0F0FF0E0DFB3uLL,
+        0xA5EDEEF83DBCBA51uLL, 0xFC4F0A2A0EA4371EuLL, 0xE83E1DA85CB38429uLL,
+        0xDC8FF882BA1B1CE2uLL, 0xCD45505E8353E80DuLL, 0x18D19A00D4DB0717uLL,
+        0x34A0CFEDA5F38101uLL, 0x0BE77E518887CAF2uLL, 0x1E341438B3C45136uLL,
+        0xE05797F49089CCF9uLL, 0xFFD23F9DF2591D14uLL, 0x543DDA228595C5CDuLL,
+        0x661F81FD99052A33uLL, 0x8736E641DB0F7B76uLL, 0x15227725418E5307uLL,
+        0xE25F7F46162EB2FAuLL, 0x48A8B2126C13D9FEuLL, 0xAFDC541792E76EEAuLL,
+        0x03D912BFC6D1898FuLL, 0x31B1AAFA1B83F51BuLL, 0xF1AC2796E42AB7D9uLL,
+        0x40A3A7D7FCD2EBACuLL, 0x1056136D0AFBBCC5uLL, 0x7889E1DD9A6D0C85uLL,
+        0xD33525782A7974AAuLL, 0xA7E25D09078AC09BuLL, 0xBD4138B3EAC6EDD0uLL,
+        0x920ABFBE71EB9E70uLL, 0xA2A5D0F54FC2625CuLL, 0xC054E36B0B1290A3uLL,
+        0xF6DD59FF62FE932BuLL, 0x3537354511A8AC7DuLL, 0xCA845E9172FADCD4uLL,
+        0x84F82B60329D20DCuLL, 0x79C62CE1CD672F18uLL, 0x8B09A2ADD124642CuLL,
+        0xD0C1E96A19D9E726uLL, 0x5A786A9B4BA9500CuLL, 0x0E020336634C43F3uLL,
+        0xC17B474AEB66D822uLL, 0x6A731AE3EC9BAAC2uLL, 0x8226667AE0840258uLL,
+        0x67D4567691CAECA5uLL, 0x1D94155C4875ADB5uLL, 0x6D00FD985B813FDFuLL,
+        0x51286EFCB774CD06uLL, 0x5E8834471FA744AFuLL, 0xF72CA0AEE761AE2EuLL,
+        0xBE40E4CDAEE8E09AuLL, 0xE9970BBB5118F665uLL, 0x726E4BEB33DF1964uLL,
+        0x703B000729199762uLL, 0x4631D816F5EF30A7uLL, 0xB880B5B51504A6BEuLL,
+        0x641793C37ED84B6CuLL, 0x7B21ED77F6E97D96uLL, 0x776306312EF96B73uLL,
+        0xAE528948E86FF3F4uLL, 0x53DBD7F286A3F8F8uLL, 0x16CADCE74CFC1063uLL,
+        0x005C19BDFA52C6DDuLL, 0x68868F5D64D46AD3uLL, 0x3A9D512CCF1E186AuLL,
+        0x367E62C2385660AEuLL, 0xE359E7EA77DCB1D7uLL, 0x526C0773749ABE6EuLL,
+        0x735AE5F9D09F734BuLL, 0x493FC7CC8A558BA8uLL, 0xB0B9C1533041AB45uLL,
+        0x321958BA470A59BDuLL, 0x852DB00B5F46C393uLL, 0x91209B2BD336B0E5uLL,
+        0x6E604F7D659EF19FuLL, 0xB99A8AE2782CCB24uLL, 0xCCF52AB6C814C4C7uLL,
+        0x4727D9AFBE11727BuLL, 0x7E950D0C0121B34DuLL, 0x756F435670AD471FuLL,
+        0xF5ADD442615A6849uLL, 0x4E87E09980B9957AuLL, 0x2ACFA1DF50AEE355uLL,
+        0xD898263AFD2FD556uLL, 0xC8F4924DD80C8FD6uLL, 0xCF99CA3D754A173AuLL,
+        0xFE477BACAF91BF3CuLL, 0xED5371F6D690C12DuLL, 0x831A5C285E687094uLL,
+        0xC5D3C90A3708A0A4uLL, 0x0F7F903717D06580uLL, 0x19F9BB13B8FDF27FuLL,
+        0xB1BD6F1B4D502843uLL, 0x1C761BA38FFF4012uLL, 0x0D1530C4E2E21F3BuLL,
+        0x8943CE69A7372C8AuLL, 0xE5184E11FEB5CE66uLL, 0x618BDB80BD736621uLL,
+        0x7D29BAD68B574D0BuLL, 0x81BB613E25E6FE5BuLL, 0x071C9C10BC07913FuLL,
+        0xC7BEEB7909AC2D97uLL, 0xC3E58D353BC5D757uLL, 0xEB017892F38F61E8uLL,
+        0xD4EFFB9C9B1CC21AuLL, 0x99727D26F494F7ABuLL, 0xA3E063A2956B3E03uLL,
+        0x9D4A8B9A4AA09C30uLL, 0x3F6AB7D500090FB4uLL, 0x9CC0F2A057268AC0uLL,
+        0x3DEE9D2DEDBF42D1uLL, 0x330F49C87960A972uLL, 0xC6B2720287421B41uLL,
+        0x0AC59EC07C00369CuLL, 0xEF4EAC49CB353425uLL, 0xF450244EEF0129D8uLL,
+        0x8ACC46E5CAF4DEB6uLL, 0x2FFEAB63989263F7uLL, 0x8F7CB9FE5D7A4578uLL,
+        0x5BD8F7644E634635uLL, 0x427A7315BF2DC900uLL, 0x17D0C4AA2125261CuLL,
+        0x3992486C93518E50uLL, 0xB4CBFEE0A2D7D4C3uLL, 0x7C75D6202C5DDD8DuLL,
+        0xDBC295D8E35B6C61uLL, 0x60B369D302032B19uLL, 0xCE42685FDCE44132uLL,
+        0x06F3DDB9DDF65610uLL, 0x8EA4D21DB5E148F0uLL, 0x20B0FCE62FCD496FuLL,
+        0x2C1B912358B0EE31uLL, 0xB28317B818F5A308uLL, 0xA89C1E189CA6D2CFuLL,
+        0x0C6B18576AAADBC8uLL, 0xB65DEAA91299FAE3uLL, 0xFB2B794B7F1027E7uLL,
+        0x04E4317F443B5BEBuLL, 0x4B852D325939D0A6uLL, 0xD5AE6BEEFB207FFCuLL,
+        0x309682B281C7D374uLL, 0xBAE309A194C3B475uLL, 0x8CC3F97B13B49F05uLL,
+        0x98A9422FF8293967uLL, 0x244B16B01076FF7CuLL, 0xF8BF571C663D67EEuLL,
+        0x1F0D6758EEE30DA1uLL, 0xC9B611D97ADEB9B7uLL, 0xB7AFD5887B6C57A2uLL,
+        0x6290AE846B984FE1uLL, 0x94DF4CDEACC1A5FDuLL, 0x058A5BD1C5483AFFuLL,
+        0x63166CC142BA3C37uLL, 0x8DB8526EB2F76F40uLL, 0xE10880036F0D6D4EuLL,
+        0x9E0523C9971D311DuLL, 0x45EC2824CC7CD691uLL, 0x575B8359E62382C9uLL,
+        0xFA9E400DC4889995uLL, 0xD1823ECB45721568uLL, 0xDAFD983B8206082FuLL,
+        0xAA7D29082386A8CBuLL, 0x269FCD4403B87588uLL, 0x1B91F5F728BDD1E0uLL,
+        0xE4669F39040201F6uLL, 0x7A1D7C218CF04ADEuLL, 0x65623C29D79CE5CEuLL,
+        0x2368449096C00BB1uLL, 0xAB9BF1879DA503BAuLL, 0xBC23ECB1A458058EuLL,
+        0x9A58DF01BB401ECCuLL, 0xA070E868A85F143DuLL, 0x4FF188307DF2239EuLL,
+        0x14D565B41A641183uLL, 0xEE13337452701602uLL, 0x950E3DCF3F285E09uLL,
+        0x59930254B9C80953uLL, 0x3BF299408930DA6DuLL, 0xA955943F53691387uLL,
+        0xA15EDECAA9CB8784uLL, 0x29142127352BE9A0uLL, 0x76F0371FFF4E7AFBuLL,
+        0x0239F450274F2228uLL, 0xBB073AF01D5E868BuLL, 0xBFC80571C10E96C1uLL,
+        0xD267088568222E23uLL, 0x9671A3D48E80B5B0uLL, 0x55B5D38AE193BB81uLL,
+        0x693AE2D0A18B04B8uLL, 0x5C48B4ECADD5335FuLL, 0xFD743B194916A1CAuLL,
+        0x2577018134BE98C4uLL, 0xE77987E83C54A4ADuLL, 0x28E11014DA33E1B9uLL,
+        0x270CC59E226AA213uLL, 0x71495F756D1A5F60uLL, 0x9BE853FB60AFEF77uLL,
+        0xADC786A7F7443DBFuLL, 0x0904456173B29A82uLL, 0x58BC7A66C232BD5EuLL,
+        0xF306558C673AC8B2uLL, 0x41F639C6B6C9772AuLL, 0x216DEFE99FDA35DAuLL,
+        0x11640CC71C7BE615uLL, 0x93C43694565C5527uLL, 0xEA038E6246777839uLL,
+        0xF9ABF3CE5A3E2469uLL, 0x741E768D0FD312D2uLL, 0x0144B883CED652C6uLL,
+        0xC20B5A5BA33F8552uLL, 0x1AE69633C3435A9DuLL, 0x97A28CA4088CFDECuLL,
+        0x8824A43C1E96F420uLL, 0x37612FA66EEEA746uLL, 0x6B4CB165F9CF0E5AuLL,
+        0x43AA1C06A0ABFB4AuLL, 0x7F4DC26FF162796BuLL, 0x6CBACC8E54ED9B0FuLL,
+        0xA6B7FFEFD2BB253EuLL, 0x2E25BC95B0A29D4FuLL, 0x86D6A58BDEF1388CuLL,
+        0xDED74AC576B6F054uLL, 0x8030BDBC2B45805DuLL, 0x3C81AF70E94D9289uLL,
+        0x3EFF6DDA9E3100DBuLL, 0xB38DC39FDFCC8847uLL, 0x123885528D17B87EuLL,
+        0xF2DA0ED240B1B642uLL, 0x44CEFADCD54BF9A9uLL, 0x1312200E433C7EE6uLL,
+        0x9FFCC84F3A78C748uLL, 0xF0CD1F72248576BBuLL, 0xEC6974053638CFE4uLL,
+        0x2BA7B67C0CEC4E4CuLL, 0xAC2F4DF3E5CE32EDuLL, 0xCB33D14326EA4C11uLL,
+        0xA4E9044CC77E58BCuLL, 0x5F513293D934FCEFuLL, 0x5DC9645506E55444uLL,
+        0x50DE418F317DE40AuLL, 0x388CB31A69DDE259uLL, 0x2DB4A83455820A86uLL,
+        0x9010A91E84711AE9uLL, 0x4DF7F0B7B1498371uLL, 0xD62A2EABC0977179uLL,
+        0x22FAC097AA8D5C0EuLL,
+        // T3
+        0xF49FCC2FF1DAF39BuLL, 0x487FD5C66FF29281uLL, 0xE8A30667FCDCA83FuLL,
+        0x2C9B4BE3D2FCCE63uLL, 0xDA3FF74B93FBBBC2uLL, 0x2FA165D2FE70BA66uLL,
+        0xA103E279970E93D4uLL, 0xBECDEC77B0E45E71uLL, 0xCFB41E723985E497uLL,
+        0xB70AAA025EF75017uLL, 0xD42309F03840B8E0uLL, 0x8EFC1AD035898579uLL,
+        0x96C6920BE2B2ABC5uLL, 0x66AF4163375A9172uLL, 0x2174ABDCCA7127FBuLL,
+        0xB33CCEA64A72FF41uLL, 0xF04A4933083066A5uLL, 0x8D970ACDD7289AF5uLL,
+        0x8F96E8E031C8C25EuLL, 0xF3FEC02276875D47uLL, 0xEC7BF310056190DDuLL,
+        0xF5ADB0AEBB0F1491uLL, 0x9B50F8850FD58892uLL, 0x4975488358B74DE8uLL,
+        0xA3354FF691531C61uLL, 0x0702BBE481D2C6EEuLL, 0x89FB24057DEDED98uLL,
+        0xAC3075138596E902uLL, 0x1D2D3580172772EDuLL, 0xEB738FC28E6BC30DuLL,
+        0x5854EF8F63044326uLL, 0x9E5C52325ADD3BBEuLL, 0x90AA53CF325C4623uLL,
+        0xC1D24D51349DD067uLL, 0x2051CFEEA69EA624uLL, 0x13220F0A862E7E4FuLL,
+        0xCE39399404E04864uLL, 0xD9C42CA47086FCB7uLL, 0x685AD2238A03E7CCuLL,
+        0x066484B2AB2FF1DBuLL, 0xFE9D5D70EFBF79ECuLL, 0x5B13B9DD9C481854uLL,
+        0x15F0D475ED1509ADuLL, 0x0BEBCD060EC79851uLL, 0xD58C6791183AB7F8uLL,
+        0xD1187C5052F3EEE4uLL, 0xC95D1192E54E82FFuLL, 0x86EEA14CB9AC6CA2uLL,
+        0x3485BEB153677D5DuLL, 0xDD191D781F8C492AuLL, 0xF60866BAA784EBF9uLL,
+        0x518F643BA2D08C74uLL, 0x8852E956E1087C22uLL, 0xA768CB8DC410AE8DuLL,
+        0x38047726BFEC8E1AuLL, 0xA67738B4CD3B45AAuLL, 0xAD16691CEC0DDE19uLL,
+        0xC6D4319380462E07uLL, 0xC5A5876D0BA61938uLL, 0x16B9FA1FA58FD840uLL,
+        0x188AB1173CA74F18uLL, 0xABDA2F98C99C021FuLL, 0x3E0580AB134AE816uLL,
+        0x5F3B05B773645ABBuLL, 0x2501A2BE5575F2F6uLL, 0x1B2F74004E7E8BA9uLL,
+        0x1CD7580371E8D953uLL, 0x7F6ED89562764E30uLL, 0xB15926FF596F003DuLL,
+        0x9F65293DA8C5D6B9uLL, 0x6ECEF04DD690F84CuLL, 0x4782275FFF33AF88uLL,
+        0xE41433083F820801uLL, 0xFD0DFE409A1AF9B5uLL, 0x4325A3342CDB396BuLL,
+        0x8AE77E62B301B252uLL, 0xC36F9E9F6655615AuLL, 0x85455A2D92D32C09uLL,
+        0xF2C7DEA949477485uLL, 0x63CFB4C133A39EBAuLL, 0x83B040CC6EBC5462uLL,
+        0x3B9454C8FDB326B0uLL, 0x56F56A9E87FFD78CuLL, 0x2DC2940D99F42BC6uLL,
+        0x98F7DF096B096E2DuLL, 0x19A6E01E3AD852BFuLL, 0x42A99CCBDBD4B40BuLL,
+        0xA59998AF45E9C559uLL, 0x366295E807D93186uLL, 0x6B48181BFAA1F773uLL,
+        0x1FEC57E2157A0A1DuLL, 0x4667446AF6201AD5uLL, 0xE615EBCACFB0F075uLL,
+        0xB8F31F4F68290778uLL, 0x22713ED6CE22D11EuLL, 0x3057C1A72EC3C93BuLL,
+        0xCB46ACC37C3F1F2FuLL, 0xDBB893FD02AAF50EuLL, 0x331FD92E600B9FCFuLL,
+        0xA498F96148EA3AD6uLL, 0xA8D8426E8B6A83EAuLL, 0xA089B274B7735CDCuLL,
+        0x87F6B3731E524A11uLL, 0x118808E5CBC96749uLL, 0x9906E4C7B19BD394uLL,
+        0xAFED7F7E9B24A20CuLL, 0x6509EADEEB3644A7uLL, 0x6C1EF1D3E8EF0EDEuLL,
+        0xB9C97D43E9798FB4uLL, 0xA2F2D784740C28A3uLL, 0x7B8496476197566FuLL,
+        0x7A5BE3E6B65F069DuLL, 0xF96330ED78BE6F10uLL, 0xEEE60DE77A076A15uLL,
+        0x2B4BEE4AA08B9BD0uLL, 0x6A56A63EC7B8894EuLL, 0x02121359BA34FEF4uLL,
+        0x4CBF99F8283703FCuLL, 0x398071350CAF30C8uLL, 0xD0A77A89F017687AuLL,
+        0xF1C1A9EB9E423569uLL, 0x8C7976282DEE8199uLL, 0x5D1737A5DD1F7ABDuLL,
+        0x4F53433C09A9FA80uLL, 0xFA8B0C53DF7CA1D9uLL, 0x3FD9DCBC886CCB77uLL,
+        0xC040917CA91B4720uLL, 0x7DD00142F9D1DCDFuLL, 0x8476FC1D4F387B58uLL,
+        0x23F8E7C5F3316503uLL, 0x032A2244E7E37339uLL, 0x5C87A5D750F5A74BuLL,
+        0x082B4CC43698992EuLL, 0xDF917BECB858F63CuLL, 0x3270B8FC5BF86DDAuLL,
+        0x10AE72BB29B5DD76uLL, 0x576AC94E7700362BuLL, 0x1AD112DAC61EFB8FuLL,
+        0x691BC30EC5FAA427uLL, 0xFF246311CC327143uLL, 0x3142368E30E53206uLL,
+        0x71380E31E02CA396uLL, 0x958D5C960AAD76F1uLL, 0xF8D6F430C16DA536uLL,
+        0xC8FFD13F1BE7E1D2uLL, 0x7578AE66004DDBE1uLL, 0x05833F01067BE646uLL,
+        0xBB34B5AD3BFE586DuLL, 0x095F34C9A12B97F0uLL, 0x247AB64525D60CA8uLL,
+        0xDCDBC6F3017477D1uLL, 0x4A2E14D4DECAD24DuLL, 0xBDB5E6D9BE0A1EEBuLL,
+        0x2A7E70F7794301ABuLL, 0xDEF42D8A270540FDuLL, 0x01078EC0A34C22C1uLL,
+        0xE5DE511AF4C16387uLL, 0x7EBB3A52BD9A330AuLL, 0x77697857AA7D6435uLL,
+        0x004E831603AE4C32uLL, 0xE7A21020AD78E312uLL, 0x9D41A70C6AB420F2uLL,
+        0x28E06C18EA1141E6uLL, 0xD2B28CBD984F6B28uLL, 0x26B75F6C446E9D83uLL,
+        0xBA47568C4D418D7FuLL, 0xD80BADBFE6183D8EuLL, 0x0E206D7F5F166044uLL,
+        0xE258A43911CBCA3EuLL, 0x723A1746B21DC0BCuLL, 0xC7CAA854F5D7CDD3uLL,
+        0x7CAC32883D261D9CuLL, 0x7690C26423BA942CuLL, 0x17E55524478042B8uLL,
+        0xE0BE477656A2389FuLL, 0x4D289B5E67AB2DA0uLL, 0x44862B9C8FBBFD31uLL,
+        0xB47CC8049D141365uLL, 0x822C1B362B91C793uLL, 0x4EB14655FB13DFD8uLL,
+        0x1ECBBA0714E2A97BuLL, 0x6143459D5CDE5F14uLL, 0x53A8FBF1D5F0AC89uLL,
+        0x97EA04D81C5E5B00uLL, 0x622181A8D4FDB3F3uLL, 0xE9BCD341572A1208uLL,
+        0x1411258643CCE58AuLL, 0x9144C5FEA4C6E0A4uLL, 0x0D33D06565CF620FuLL,
+        0x54A48D489F219CA1uLL, 0xC43E5EAC6D63C821uLL, 0xA9728B3A72770DAFuLL,
+        0xD7934E7B20DF87EFuLL, 0xE35503B61A3E86E5uLL, 0xCAE321FBC819D504uLL,
+        0x129A50B3AC60BFA6uLL, 0xCD5E68EA7E9FB6C3uLL, 0xB01C90199483B1C7uLL,
+        0x3DE93CD5C295376CuLL, 0xAED52EDF2AB9AD13uLL, 0x2E60F512C0A07884uLL,
+        0xBC3D86A3E36210C9uLL, 0x35269D9B163951CEuLL, 0x0C7D6E2AD0CDB5FAuLL,
+        0x59E86297D87F5733uLL, 0x298EF221898DB0E7uLL, 0x55000029D1A5AA7EuLL,
+        0x8BC08AE1B5061B45uLL, 0xC2C31C2B6C92703AuLL, 0x94CC596BAF25EF42uLL,
+        0x0A1D73DB22540456uLL, 0x04B6A0F9D9C4179AuLL, 0xEFFDAFA2AE3D3C60uLL,
+        0xF7C8075BB49496C4uLL, 0x9CC5C7141D1CD4E3uLL, 0x78BD1638218E5534uLL,
+        0xB2F11568F850246AuLL, 0xEDFABCFA9502BC29uLL, 0x796CE5F2DA23051BuLL,
+        0xAAE128B0DC93537CuLL, 0x3A493DA0EE4B29AEuLL, 0xB5DF6B2C416895D7uLL,
+        0xFCABBD25122D7F37uLL, 0x70810B58105DC4B1uLL, 0xE10FDD37F7882A90uLL,
+        0x524DCAB5518A3F5CuLL, 0x3C9E85878451255BuLL, 0x4029828119BD34E2uLL,
+        0x74A05B6F5D3CECCBuLL, 0xB610021542E13ECAuLL, 0x0FF979D12F59E2ACuLL,
+        0x6037DA27E4F9CC50uLL, 0x5E92975A0DF1847DuLL, 0xD66DE190D3E623FEuLL,
+        0x5032D6B87B568048uLL, 0x9A36B7CE8235216EuLL, 0x80272A7A24F64B4AuLL,
+        0x93EFED8B8C6916F7uLL, 0x37DDBFF44CCE1555uLL, 0x4B95DB5D4B99BD25uLL,
+        0x92D3FDA169812FC0uLL, 0xFB1A4A9A90660BB6uLL, 0x730C196946A4B9B2uLL,
+        0x81E289AA7F49DA68uLL, 0x64669A0F83B1A05FuLL, 0x27B3FF7D9644F48BuLL,
+        0xCC6B615C8DB675B3uLL, 0x674F20B9BCEBBE95uLL, 0x6F31238275655982uLL,
+        0x5AE488713E45CF05uLL, 0xBF619F9954C21157uLL, 0xEABAC46040A8EAE9uLL,
+        0x454C6FE9F2C0C1CDuLL, 0x419CF6496412691CuLL, 0xD3DC3BEF265B0F70uLL,
+        0x6D0E60F5C3578A9EuLL,
+        // T4
+        0x5B0E608526323C55uLL, 0x1A46C1A9FA1B59F5uLL, 0xA9E245A17C4C8FFAuLL,
+        0x65CA5159DB2955D7uLL, 0x05DB0A76CE35AFC2uLL, 0x81EAC77EA9113D45uLL,
+        0x528EF88AB6AC0A0DuLL, 0xA09EA253597BE3FFuLL, 0x430DDFB3AC48CD56uLL,
+        0xC4B3A67AF45CE46FuLL, 0x4ECECFD8FBE2D05EuLL, 0x3EF56F10B39935F0uLL,
+        0x0B22D6829CD619C6uLL, 0x17FD460A74DF2069uLL, 0x6CF8CC8E8510ED40uLL,
+        0xD6C824BF3A6ECAA7uLL, 0x61243D581A817049uLL, 0x048BACB6BBC163A2uLL,
+        0xD9A38AC27D44CC32uLL, 0x7FDDFF5BAAF410ABuLL, 0xAD6D495AA804824BuLL,
+        0xE1A6A74F2D8C9F94uLL, 0xD4F7851235DEE8E3uLL, 0xFD4B7F886540D893uLL,
+        0x247C20042AA4BFDAuLL, 0x096EA1C517D1327CuLL, 0xD56966B4361A6685uLL,
+        0x277DA5C31221057DuLL, 0x94D59893A43ACFF7uLL, 0x64F0C51CCDC02281uLL,
+        0x3D33BCC4FF6189DBuLL, 0xE005CB184CE66AF1uLL, 0xFF5CCD1D1DB99BEAuLL,
+        0xB0B854A7FE42980FuLL, 0x7BD46A6A718D4B9FuLL, 0xD10FA8CC22A5FD8CuLL,
+        0xD31484952BE4BD31uLL, 0xC7FA975FCB243847uLL, 0x4886ED1E5846C407uLL,
+        0x28CDDB791EB70B04uLL, 0xC2B00BE2F573417FuLL, 0x5C9590452180F877uLL,
+        0x7A6BDDFFF370EB00uLL, 0xCE509E38D6D9D6A4uLL, 0xEBEB0F00647FA702uLL,
+        0x1DCC06CF76606F06uLL, 0xE4D9F28BA286FF0AuLL, 0xD85A305DC918C262uLL,
+        0x475B1D8732225F54uLL, 0x2D4FB51668CCB5FEuLL, 0xA679B9D9D72BBA20uLL,
+        0x53841C0D912D43A5uLL, 0x3B7EAA48BF12A4E8uLL, 0x781E0E47F22F1DDFuLL,
+        0xEFF20CE60AB50973uLL, 0x20D261D19DFFB742uLL, 0x16A12B03062A2E39uLL,
+        0x1960EB2239650495uLL, 0x251C16FED50EB8B8uLL, 0x9AC0C330F826016EuLL,
+        0xED152665953E7671uLL, 0x02D63194A6369570uLL, 0x5074F08394B1C987uLL,
+        0x70BA598C90B25CE1uLL, 0x794A15810B9742F6uLL, 0x0D5925E9FCAF8C6CuLL,
+        0x3067716CD868744EuLL, 0x910AB077E8D7731BuLL, 0x6A61BBDB5AC42F61uLL,
+        0x93513EFBF0851567uLL, 0xF494724B9E83E9D5uLL, 0xE887E1985C09648DuLL,
+        0x34B1D3C675370CFDuLL, 0xDC35E433BC0D255DuLL, 0xD0AAB84234131BE0uLL,
+        0x08042A50B48B7EAFuLL, 0x9997C4EE44A3AB35uLL, 0x829A7B49201799D0uLL,
+        0x263B8307B7C54441uLL, 0x752F95F4FD6A6CA6uLL, 0x927217402C08C6E5uLL,
+        0x2A8AB754A795D9EEuLL, 0xA442F7552F72943DuLL, 0x2C31334E19781208uLL,
+        0x4FA98D7CEAEE6291uLL, 0x55C3862F665DB309uLL, 0xBD0610175D53B1F3uLL,
+        0x46FE6CB840413F27uLL, 0x3FE03792DF0CFA59uLL, 0xCFE700372EB85E8FuLL,
+        0xA7BE29E7ADBCE118uLL, 0xE544EE5CDE8431DDuLL, 0x8A781B1B41F1873EuLL,
+        0xA5C94C78A0D2F0E7uLL, 0x39412E2877B60728uLL, 0xA1265EF3AFC9A62CuLL,
+        0xBCC2770C6A2506C5uLL, 0x3AB66DD5DCE1CE12uLL, 0xE65499D04A675B37uLL,
+        0x7D8F523481BFD216uLL, 0x0F6F64FCEC15F389uLL, 0x74EFBE618B5B13C8uLL,
+        0xACDC82B714273E1DuLL, 0xDD40BFE003199D17uLL, 0x37E99257E7E061F8uLL,
+        0xFA52626904775AAAuLL, 0x8BBBF63A463D56F9uLL, 0xF0013F1543A26E64uLL,
+        0xA8307E9F879EC898uLL, 0xCC4C27A4150177CCuLL, 0x1B432F2CCA1D3348uLL,
+        0xDE1D1F8F9F6FA013uLL, 0x606602A047A7DDD6uLL, 0xD237AB64CC1CB2C7uLL,
+        0x9B938E7225FCD1D3uLL, 0xEC4E03708E0FF476uLL, 0xFEB2FBDA3D03C12DuLL,
+        0xAE0BCED2EE43889AuLL, 0x22CB8923EBFB4F43uLL, 0x69360D013CF7396DuLL,
+        0x855E3602D2D4E022uLL, 0x073805BAD01F784CuLL, 0x33E17A133852F546uLL,
+        0xDF4874058AC7B638uLL, 0xBA92B29C678AA14AuLL, 0x0CE89FC76CFAADCDuLL,
+        0x5F9D4E0908339E34uLL, 0xF1AFE9291F5923B9uLL, 0x6E3480F60F4A265FuLL,
+        0xEEBF3A2AB29B841CuLL, 0xE21938A88F91B4ADuLL, 0x57DFEFF845C6D3C3uLL,
+        0x2F006B0BF62CAAF2uLL, 0x62F479EF6F75EE78uLL, 0x11A55AD41C8916A9uLL,
+        0xF229D29084FED453uLL, 0x42F1C27B16B000E6uLL, 0x2B1F76749823C074uLL,
+        0x4B76ECA3C2745360uLL, 0x8C98F463B91691BDuLL, 0x14BCC93CF1ADE66AuLL,
+        0x8885213E6D458397uLL, 0x8E177DF0274D4711uLL, 0xB49B73B5503F2951uLL,
+        0x10168168C3F96B6BuLL, 0x0E3D963B63CAB0AEuLL, 0x8DFC4B5655A1DB14uLL,
+        0xF789F1356E14DE5CuLL, 0x683E68AF4E51DAC1uLL, 0xC9A84F9D8D4B0FD9uLL,
+        0x3691E03F52A0F9D1uLL, 0x5ED86E46E1878E80uLL, 0x3C711A0E99D07150uLL,
+        0x5A0865B20C4E9310uLL, 0x56FBFC1FE4F0682EuLL, 0xEA8D5DE3105EDF9BuLL,
+        0x71ABFDB12379187AuLL, 0x2EB99DE1BEE77B9CuLL, 0x21ECC0EA33CF4523uLL,
+        0x59A4D7521805C7A1uLL, 0x3896F5EB56AE7C72uLL, 0xAA638F3DB18F75DCuLL,
+        0x9F39358DABE9808EuLL, 0xB7DEFA91C00B72ACuLL, 0x6B5541FD62492D92uLL,
+        0x6DC6DEE8F92E4D5BuLL, 0x353F57ABC4BEEA7EuLL, 0x735769D6DA5690CEuLL,
+        0x0A234AA642391484uLL, 0xF6F9508028F80D9DuLL, 0xB8E319A27AB3F215uLL,
+        0x31AD9C1151341A4DuLL, 0x773C22A57BEF5805uLL, 0x45C7561A07968633uLL,
+        0xF913DA9E249DBE36uLL, 0xDA652D9B78A64C68uLL, 0x4C27A97F3BC334EFuLL,
+        0x76621220E66B17F4uLL, 0x967743899ACD7D0BuLL, 0xF3EE5BCAE0ED6782uLL,
+        0x409F753600C879FCuLL, 0x06D09A39B5926DB6uLL, 0x6F83AEB0317AC588uLL,
+        0x01E6CA4A86381F21uLL, 0x66FF3462D19F3025uLL, 0x72207C24DDFD3BFBuLL,
+        0x4AF6B6D3E2ECE2EBuLL, 0x9C994DBEC7EA08DEuLL, 0x49ACE597B09A8BC4uLL,
+        0xB38C4766CF0797BAuLL, 0x131B9373C57C2A75uLL, 0xB1822CCE61931E58uLL,
+        0x9D7555B909BA1C0CuLL, 0x127FAFDD937D11D2uLL, 0x29DA3BADC66D92E4uLL,
+        0xA2C1D57154C2ECBCuLL, 0x58C5134D82F6FE24uLL, 0x1C3AE3515B62274FuLL,
+        0xE907C82E01CB8126uLL, 0xF8ED091913E37FCBuLL, 0x3249D8F9C80046C9uLL,
+        0x80CF9BEDE388FB63uLL, 0x1881539A116CF19EuLL, 0x5103F3F76BD52457uLL,
+        0x15B7E6F5AE47F7A8uLL, 0xDBD7C6DED47E9CCFuLL, 0x44E55C410228BB1AuLL,
+        0xB647D4255EDB4E99uLL, 0x5D11882BB8AAFC30uLL, 0xF5098BBB29D3212AuLL,
+        0x8FB5EA14E90296B3uLL, 0x677B942157DD025AuLL, 0xFB58E7C0A390ACB5uLL,
+        0x89D3674C83BD4A01uLL, 0x9E2DA4DF4BF3B93BuLL, 0xFCC41E328CAB4829uLL,
+        0x03F38C96BA582C52uLL, 0xCAD1BDBD7FD85DB2uLL, 0xBBB442C16082AE83uLL,
+        0xB95FE86BA5DA9AB0uLL, 0xB22E04673771A93FuLL, 0x845358C9493152D8uLL,
+        0xBE2A488697B4541EuLL, 0x95A2DC2DD38E6966uLL, 0xC02C11AC923C852BuLL,
+        0x2388B1990DF2A87BuLL, 0x7C8008FA1B4F37BEuLL, 0x1F70D0C84D54E503uLL,
+        0x5490ADEC7ECE57D4uLL, 0x002B3C27D9063A3AuLL, 0x7EAEA3848030A2BFuLL,
+        0xC602326DED2003C0uLL, 0x83A7287D69A94086uLL, 0xC57A5FCB30F57A8AuLL,
+        0xB56844E479EBE779uLL, 0xA373B40F05DCBCE9uLL, 0xD71A786E88570EE2uLL,
+        0x879CBACDBDE8F6A0uLL, 0x976AD1BCC164A32FuLL, 0xAB21E25E9666D78BuLL,
+        0x901063AAE5E5C33CuLL, 0x9818B34448698D90uLL, 0xE36487AE3E1E8ABBuLL,
+        0xAFBDF931893BDCB4uLL, 0x6345A0DC5FBBD519uLL, 0x8628FE269B9465CAuLL,
+        0x1E5D01603F9C51ECuLL, 0x4DE44006A15049B7uLL, 0xBF6C70E5F776CBB1uLL,
+        0x411218F2EF552BEDuLL, 0xCB0C0708705A36A3uLL, 0xE74D14754F986044uLL,
+        0xCD56D9430EA8280EuLL, 0xC12591D7535F5065uLL, 0xC83223F1720AEF96uLL,
+        0xC3A0396F7363A51FuLL,
+        }};
+        // clang-format on
+    }  // namespace
+
+    const sbox_t &DefaultSBox () noexcept {
+        return default_sbox;
+    }
+}  // namespace Tiger
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "DigestIndex.hpp"
+
+#include "FileIO.hpp"
+#include "Internal.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+#if defined(__SSE2__)
+#    include <emmintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define TIGER_HAVE_POSIX_IO 1
+#endif
+
+namespace Tiger {
+    using namespace internal;
+
+    namespace {
+        using Entry = DigestIndex::Entry;
+
+        const size_t GROUP_SIZE = DigestIndex::GROUP_SIZE;
+
+        /// Header of the file: Magic, # of groups, # of entries and a reserved word (in little-endian).
+        const char   FILE_MAGIC[8] = {'T', 'G', 'R', 'D', 'I', 'D', 'X', '1'};
+        const size_t HEADER_SIZE   = 32;
+
+        static_assert (sizeof (Entry) == 32, "Entries should be packed");
+
+        /// The leading 8 bytes of the digest.
+        uint64_t hash_of (const digest_t &digest) noexcept {
+            return load_le64 (digest.data ());
+        }
+
+        /// Non-zero tag of the slot holding the digest with the HASH.
+        uint8_t tag_of (uint64_t hash) noexcept {
+            return static_cast<uint8_t> (0x80u | (hash >> 57u));
+        }
+
+        /// Bit mask of the slots in the GROUP with the TAG.
+        uint32_t match (const uint8_t *group, uint8_t tag) noexcept {
+#if defined(__SSE2__)
+            auto v = _mm_loadu_si128 (reinterpret_cast<const __m128i *> (group));
+            return static_cast<uint32_t> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (v, _mm_set1_epi8 (static_cast<char> (tag)))));
+#else
+            uint32_t result = 0;
+            for (size_t i = 0; i < GROUP_SIZE; ++i) {
+                result |= static_cast<uint32_t> (group[i] == tag) << i;
+            }
+            return result;
+#endif
+        }
+
+        /// Index of the lowest set bit of the (non-zero) MASK.
+        size_t lowest_bit (uint32_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t> (__builtin_ctz (mask));
+#else
+            size_t result = 0;
+            while ((mask & 1u) == 0) {
+                mask >>= 1u;
+                ++result;
+            }
+            return result;
+#endif
+        }
+
+        /// The slot returned by `probe` when every group is full.
+        const size_t NO_SLOT = ~static_cast<size_t> (0);
+
+        /**
+         * Probes the groups for the DIGEST.
+         *
+         * @remarks Visits each group once at most, so a full table (only
+         *          from a crafted file, `DigestIndex` never fills up) is
+         *          not looped over forever.
+         * @param slot Receives the slot holding the DIGEST if found, the empty slot to store it otherwise
+         *             (NO_SLOT if none)
+         * @return true if found
+         */
+        bool probe (const uint8_t *tags, const Entry *entries, size_t cntGroup, const digest_t &digest, size_t &slot) noexcept {
+            auto const hash = hash_of (digest);
+            auto const tag  = tag_of (hash);
+            auto const mask = cntGroup - 1;
+            auto       g    = static_cast<size_t> (hash & mask);
+            for (size_t k = 0; k < cntGroup; ++k, g = (g + 1) & mask) {
+                auto const base = g * GROUP_SIZE;
+                for (auto m = match (tags + base, tag); m != 0; m &= m - 1) {
+                    auto const i = base + lowest_bit (m);
+                    if (entries[i].digest == digest) {
+                        slot = i;
+                        return true;
+                    }
+                }
+                // Stops at the first group with a vacancy (no entry is ever removed).
+                if (auto m = match (tags + base, 0)) {
+                    slot = base + lowest_bit (m);
+                    return false;
+                }
+            }
+            slot = NO_SLOT;
+            return false;
+        }
+
+        /// # of groups for COUNT entries (at 7/8 load at most).
+        size_t groups_for (size_t count) noexcept {
+            size_t result = 1;
+            while (result * GROUP_SIZE * 7 < count * 8) {
+                result *= 2;
+            }
+            return result;
+        }
+
+        /// Validates the header and the size of the file contents.  Returns # of groups and # of entries.
+        bool parse_header (const uint8_t *data, size_t size, size_t &cntGroup, size_t &count) noexcept {
+            if (size < HEADER_SIZE || ::memcmp (data, FILE_MAGIC, sizeof (FILE_MAGIC)) != 0) {
+                return false;
+            }
+            auto const groups    = load_le64 (data + 8);
+            auto const entries   = load_le64 (data + 16);
+            auto const groupSize = GROUP_SIZE * (1 + sizeof (Entry));  // The tags and the entries
+            if (groups == 0 || (groups & (groups - 1)) != 0 || (size - HEADER_SIZE) % groupSize != 0
+                || (size - HEADER_SIZE) / groupSize != groups || groups * GROUP_SIZE <= entries) {
+                return false;
+            }
+            cntGroup = static_cast<size_t> (groups);
+            count    = static_cast<size_t> (entries);
+            return true;
+        }
+
+        std::vector<uint8_t> read_file (const std::string &path) {
+            std::unique_ptr<std::FILE, int (*) (std::FILE *)> fp {std::fopen (path.c_str (), "rb"), &std::fclose};
+            if (! fp) {
+                throw_errno (errno, path);
+            }
+            std::vector<uint8_t> result;
+            uint8_t              buffer[64 * 1024];
+            while (auto n = std::fread (buffer, 1, sizeof (buffer), fp.get ())) {
+                result.insert (result.end (), buffer, buffer + n);
+            }
+            if (std::ferror (fp.get ())) {
+                throw_errno (EIO, path);
+            }
+            return result;
+        }
+    }  // namespace
+
+    const size_t DigestIndex::GROUP_SIZE;
+
+    DigestIndex::DigestIndex (size_t capacity) {
+        Reserve (capacity);
+    }
+
+    bool DigestIndex::Find (const digest_t &digest, uint64_t &value) const noexcept {
+        size_t slot;
+        if (! probe (tags_.data (), entries_.data (), tags_.size () / GROUP_SIZE, digest, slot)) {
+            return false;
+        }
+        value = load_le64 (entries_[slot].value.data ());
+        return true;
+    }
+
+    std::pair<uint64_t, bool> DigestIndex::Insert (const digest_t &digest, uint64_t value) {
+        Reserve (count_ + 1);
+        size_t slot;
+        if (probe (tags_.data (), entries_.data (), tags_.size () / GROUP_SIZE, digest, slot)) {
+            return std::make_pair (load_le64 (entries_[slot].value.data ()), false);
+        }
+        tags_[slot]           = tag_of (hash_of (digest));
+        entries_[slot].digest = digest;
+        to_bytes (entries_[slot].value.data (), value);
+        ++count_;
+        return std::make_pair (value, true);
+    }
+
+    void DigestIndex::Reserve (size_t count) {
+        auto const cntGroup = groups_for (count);
+        if (cntGroup * GROUP_SIZE <= tags_.size ()) {
+            return;
+        }
+        std::vector<uint8_t> tags (cntGroup * GROUP_SIZE, 0);
+        std::vector<Entry>   entries (cntGroup * GROUP_SIZE);
+        for (size_t i = 0; i < tags_.size (); ++i) {
+            if (tags_[i] != 0) {
+                size_t slot;
+                probe (tags.data (), entries.data (), cntGroup, entries_[i].digest, slot);
+                tags[slot]    = tags_[i];
+                entries[slot] = entries_[i];
+            }
+        }
+        tags_.swap (tags);
+        entries_.swap (entries);
+    }
+
+    void DigestIndex::Save (const std::string &path) const {
+        uint8_t header[HEADER_SIZE] = {};
+        ::memcpy (header, FILE_MAGIC, sizeof (FILE_MAGIC));
+        to_bytes (header + 8, static_cast<uint64_t> (tags_.size () / GROUP_SIZE));
+        to_bytes (header + 16, static_cast<uint64_t> (count_));
+
+        replace_file (path,
+                      {ByteView {header, sizeof (header)},
+                       ByteView {tags_.data (), tags_.size ()},
+                       ByteView {entries_.data (), entries_.size () * sizeof (Entry)}});
+    }
+
+    DigestIndex DigestIndex::Load (const std::string &path) {
+        auto const data = read_file (path);
+
+        size_t cntGroup;
+        size_t count;
+        if (! parse_header (data.data (), data.size (), cntGroup, count)) {
+            throw_errno (EINVAL, path);
+        }
+        DigestIndex result;
+        auto const *tags = data.data () + HEADER_SIZE;
+        result.tags_.assign (tags, tags + cntGroup * GROUP_SIZE);
+        // The probes stop at the empty slots: Rejects the tables without any (or with a wrong count).
+        auto const cntEmpty = static_cast<size_t> (std::count (result.tags_.begin (), result.tags_.end (), 0));
+        if (cntEmpty == 0 || result.tags_.size () - cntEmpty != count) {
+            throw_errno (EINVAL, path);
+        }
+        result.entries_.resize (cntGroup * GROUP_SIZE);
+        ::memcpy (result.entries_.data (), tags + result.tags_.size (), result.entries_.size () * sizeof (Entry));
+        result.count_ = count;
+        return result;
+    }
+
+    MappedDigestIndex::MappedDigestIndex (const std::string &path) {
+        const uint8_t *data = nullptr;
+#ifdef TIGER_HAVE_POSIX_IO
+        int fd = ::open (path.c_str (), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw_errno (errno, path);
+        }
+        struct stat st {};
+        if (::fstat (fd, &st) != 0) {
+            auto err = errno;
+            ::close (fd);
+            throw_errno (err, path);
+        }
+        size_ = static_cast<size_t> (st.st_size);
+        if (0 < size_) {
+            auto addr = ::mmap (nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            if (addr == MAP_FAILED) {
+                auto err = errno;
+                ::close (fd);
+                throw_errno (err, path);
+            }
+            addr_ = addr;
+#    ifdef MADV_RANDOM
+            ::madvise (addr_, size_, MADV_RANDOM);
+#    endif
+        }
+        ::close (fd);
+        data = static_cast<const uint8_t *> (addr_);
+#else
+        owned_ = read_file (path);
+        size_  = owned_.size ();
+        data   = owned_.data ();
+#endif
+        if (! parse_header (data, size_, cntGroup_, count_)) {
+#ifdef TIGER_HAVE_POSIX_IO
+            if (addr_ != nullptr) {
+                ::munmap (addr_, size_);
+            }
+#endif
+            throw_errno (EINVAL, path);
+        }
+        tags_    = data + HEADER_SIZE;
+        entries_ = reinterpret_cast<const Entry *> (tags_ + cntGroup_ * GROUP_SIZE);
+    }
+
+    MappedDigestIndex::~MappedDigestIndex () {
+#ifdef TIGER_HAVE_POSIX_IO
+        if (addr_ != nullptr) {
+            ::munmap (addr_, size_);
+        }
+#endif
+    }
+
+    bool MappedDigestIndex::Find (const digest_t &digest, uint64_t &value) const noexcept {
+        size_t slot;
+        if (! probe (tags_, entries_, cntGroup_, digest, slot)) {
+            return false;
+        }
+        value = load_le64 (entries_[slot].value.data ());
+        return true;
+    }
+}  // namespace Tiger
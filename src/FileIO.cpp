@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "FileIO.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <functional>
+#include <system_error>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <unistd.h>
+#    define TIGER_HAVE_POSIX_IO 1
+#endif
+
+namespace Tiger { namespace internal {
+    namespace {
+        /// Suffix of the temporary file unique to the writer (process and thread).
+        std::string temporary_suffix () {
+            std::string result = ".";
+#ifdef TIGER_HAVE_POSIX_IO
+            result += std::to_string (::getpid ()) + ".";
+#endif
+            return result + std::to_string (std::hash<std::thread::id> {}(std::this_thread::get_id ())) + ".tmp";
+        }
+
+        /// Writes the PIECES to the new file PATH and syncs it.  Returns 0 or errno.
+        int write_file (const std::string &path, std::initializer_list<ByteView> pieces) {
+#ifdef TIGER_HAVE_POSIX_IO
+            int fd = ::open (path.c_str (), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+            if (fd < 0) {
+                return errno;
+            }
+            int err = 0;
+            for (auto const &piece : pieces) {
+                auto const *p    = static_cast<const char *> (piece.data);
+                size_t      left = piece.size;
+                while (err == 0 && 0 < left) {
+                    auto n = ::write (fd, p, left);
+                    if (n < 0) {
+                        err = errno == EINTR ? 0 : errno;
+                        continue;
+                    }
+                    p += n;
+                    left -= static_cast<size_t> (n);
+                }
+            }
+            if (err == 0 && ::fsync (fd) != 0) {
+                err = errno;
+            }
+            if (::close (fd) != 0 && err == 0) {
+                err = errno;
+            }
+            return err;
+#else
+            auto fp = std::fopen (path.c_str (), "wb");
+            if (fp == nullptr) {
+                return errno;
+            }
+            int err = 0;
+            for (auto const &piece : pieces) {
+                if (err == 0 && std::fwrite (piece.data, 1, piece.size, fp) != piece.size) {
+                    err = errno != 0 ? errno : EIO;
+                }
+            }
+            if (err == 0 && std::fflush (fp) != 0) {
+                err = errno != 0 ? errno : EIO;
+            }
+            if (std::fclose (fp) != 0 && err == 0) {
+                err = errno != 0 ? errno : EIO;
+            }
+            return err;
+#endif
+        }
+
+        /// Syncs the directory holding the PATH (so that the rename survives a crash).
+        void sync_directory (const std::string &path) noexcept {
+#ifdef TIGER_HAVE_POSIX_IO
+            auto const pos = path.rfind ('/');
+            auto const dir = pos == std::string::npos ? std::string {"."} : pos == 0 ? std::string {"/"} : path.substr (0, pos);
+            int        fd  = ::open (dir.c_str (), O_RDONLY | O_CLOEXEC);
+            if (0 <= fd) {
+                ::fsync (fd);
+                ::close (fd);
+            }
+#else
+            (void)path;
+#endif
+        }
+    }  // namespace
+
+    void throw_errno (int err, const std::string &path) {
+        throw std::system_error (err, std::generic_category (), path);
+    }
+
+    void replace_file (const std::string &path, std::initializer_list<ByteView> pieces) {
+        auto const tmp = path + temporary_suffix ();
+        if (auto err = write_file (tmp, pieces)) {
+            std::remove (tmp.c_str ());
+            throw_errno (err, tmp);
+        }
+        if (std::rename (tmp.c_str (), path.c_str ()) != 0) {
+            auto err = errno;
+            std::remove (tmp.c_str ());
+            throw_errno (err, path);
+        }
+        sync_directory (path);
+    }
+}}  // namespace Tiger::internal
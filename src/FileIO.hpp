@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief File helpers shared by the persistent structures.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <initializer_list>
+#include <string>
+
+namespace Tiger { namespace internal {
+    /** Throws `std::system_error` of the ERR (an errno value) on the PATH.  */
+    [[noreturn]] void throw_errno (int err, const std::string &path);
+
+    /**
+     * Replaces the file atomically with the concatenation of the PIECES.
+     *
+     * The contents go to a temporary file next to the PATH (unique to the
+     * process and the thread), which is synced to the disk and closed
+     * before it is renamed over the PATH.  The readers see either the old
+     * file or the complete new one, even across a crash.
+     *
+     * @param path   The file
+     * @param pieces The contents
+     * @throw std::system_error on I/O errors (the temporary file is removed)
+     */
+    void replace_file (const std::string &path, std::initializer_list<ByteView> pieces);
+}}  // namespace Tiger::internal
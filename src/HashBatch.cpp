@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "HashBatch.hpp"
+
+#include "MultiGenerator.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace Tiger {
+    using internal::ThreadPool;
+
+    namespace {
+        using multi_t = MultiGenerator<8>;
+
+        /// # of messages staged for the `MultiGenerator` at a time.
+        const size_t STAGE_SIZE = 64;
+
+        void hash_range (const multi_t &multi, digest_t *result, const ByteView *inputs, size_t count) noexcept {
+            std::array<const void *, STAGE_SIZE> data;
+            std::array<size_t, STAGE_SIZE>       sizes;
+
+            for (size_t off = 0; off < count; off += STAGE_SIZE) {
+                size_t n = std::min (STAGE_SIZE, count - off);
+                for (size_t i = 0; i < n; ++i) {
+                    data[i]  = inputs[off + i].data;
+                    sizes[i] = inputs[off + i].size;
+                }
+                multi.Hash (result + off, data.data (), sizes.data (), n);
+            }
+        }
+
+        /**
+         * The pool of CNTTHREAD threads kept for the calling thread.
+         *
+         * Built on the first multi-threaded batch (rebuilt when the # of
+         * threads changes) and reused by the following ones, so a batch
+         * does not pay for spawning and joining the workers.  Each calling
+         * thread owns its pool: Batches from different threads never wait
+         * for each other in `ParallelFor`.
+         */
+        ThreadPool &shared_pool (size_t cntThread) {
+            thread_local std::unique_ptr<ThreadPool> pool;
+            if (! pool || pool->Size () != cntThread) {
+                pool.reset ();  // Joins the old workers first
+                pool.reset (new ThreadPool (cntThread));
+            }
+            return *pool;
+        }
+    }  // namespace
+
+    void HashBatch (digest_t *result, const ByteView *inputs, size_t count, const HashBatchOptions &options) {
+        auto const &sbox = options.sbox != nullptr ? *options.sbox : DefaultSBox ();
+        multi_t     multi (sbox, options.passes, options.padding == Padding::Tiger2);
+
+        size_t const grain   = std::max<size_t> (1, options.grain);
+        size_t const cntTask = (count + grain - 1) / grain;
+        if (options.cntThread == 1 || cntTask < 2) {
+            hash_range (multi, result, inputs, count);
+            return;
+        }
+        size_t const cntThread = options.cntThread == 0 ? std::max<size_t> (1, std::thread::hardware_concurrency ()) : options.cntThread;
+        shared_pool (cntThread).ParallelFor (cntTask, [&] (size_t idx) {
+            size_t off = grain * idx;
+            hash_range (multi, result + off, inputs + off, std::min (grain, count - off));
+        });
+    }
+}  // namespace Tiger
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "HashFile.hpp"
+
+#include "FileIO.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define TIGER_HAVE_POSIX_IO 1
+#endif
+
+namespace Tiger {
+    using namespace internal;
+
+    namespace {
+        /// Bytes hashed per mapping window (the read-ahead is requested one window ahead).
+        const size_t MAP_WINDOW = 16u << 20u;
+
+        /**
+         * Reads the input by a background thread into a ring of buffers.
+         *
+         * The reader fills the next free buffer while the consumer hashes
+         * the filled ones, and blocks when all of them are in flight.
+         */
+        class ReadAhead {
+        public:
+            /// Reads up to SIZE bytes.  Returns the # of bytes read (0 on EOF), or -errno.
+            using read_t = std::function<ptrdiff_t (uint8_t *buffer, size_t size)>;
+
+        private:
+            read_t                            read_;
+            std::vector<std::vector<uint8_t>> buffers_;
+            std::vector<size_t>               sizes_;
+            std::mutex                        mutex_;
+            std::condition_variable           cond_;
+            size_t                            head_   = 0;  ///< Next buffer to consume
+            size_t                            filled_ = 0;  ///< # of filled buffers
+            bool                              done_   = false;
+            bool                              quit_   = false;
+            int                               error_  = 0;
+            std::thread                       thread_;
+
+        public:
+            ReadAhead (read_t read, size_t bufferSize, size_t cntBuffer)
+                    : read_ {std::move (read)}
+                    , buffers_ (std::max<size_t> (2, cntBuffer), std::vector<uint8_t> (std::max<size_t> (1, bufferSize)))
+                    , sizes_ (buffers_.size ()) {
+                thread_ = std::thread ([this] () { Run (); });
+            }
+
+            ReadAhead (const ReadAhead &) = delete;
+            ReadAhead &operator= (const ReadAhead &) = delete;
+
+            ~ReadAhead () {
+                {
+                    std::lock_guard<std::mutex> lock (mutex_);
+                    quit_ = true;
+                }
+                cond_.notify_all ();
+                thread_.join ();
+            }
+
+            /**
+             * Feeds the filled buffers to the SINK until EOF.
+             *
+             * @return 0, or errno of the failed read
+             */
+            template <typename Sink_>
+            int Drain (Sink_ &&sink) {
+                for (;;) {
+                    size_t idx;
+                    {
+                        std::unique_lock<std::mutex> lock (mutex_);
+                        cond_.wait (lock, [this] () { return 0 < filled_ || done_; });
+                        if (filled_ == 0) {
+                            return error_;
+                        }
+                        idx = head_;
+                    }
+                    sink (buffers_[idx].data (), sizes_[idx]);
+                    {
+                        std::lock_guard<std::mutex> lock (mutex_);
+                        head_ = (head_ + 1) % buffers_.size ();
+                        --filled_;
+                    }
+                    cond_.notify_all ();
+                }
+            }
+
+        private:
+            void Run () {
+                size_t tail = 0;
+                for (;;) {
+                    {
+                        std::unique_lock<std::mutex> lock (mutex_);
+                        cond_.wait (lock, [this] () { return quit_ || filled_ < buffers_.size (); });
+                        if (quit_) {
+                            return;
+                        }
+                    }
+                    auto &buffer = buffers_[tail];
+                    auto  n      = read_ (buffer.data (), buffer.size ());
+                    {
+                        std::lock_guard<std::mutex> lock (mutex_);
+                        if (n <= 0) {
+                            error_ = static_cast<int> (-n);
+                            done_  = true;
+                        }
+                        else {
+                            sizes_[tail] = static_cast<size_t> (n);
+                            ++filled_;
+                            tail = (tail + 1) % buffers_.size ();
+                        }
+                    }
+                    cond_.notify_all ();
+                    if (n <= 0) {
+                        return;
+                    }
+                }
+            }
+        };
+
+#ifdef TIGER_HAVE_POSIX_IO
+        /** Closes the file descriptor on exit.  */
+        class FileDescriptor {
+            int fd_;
+
+        public:
+            explicit FileDescriptor (int fd) : fd_ {fd} { /* NO-OP */
+            }
+            FileDescriptor (const FileDescriptor &) = delete;
+            FileDescriptor &operator= (const FileDescriptor &) = delete;
+            ~FileDescriptor () {
+                if (0 <= fd_) {
+                    ::close (fd_);
+                }
+            }
+            int Get () const { return fd_; }
+        };
+
+        /// Hashes the mapped regular file.  Returns false if mapping is not possible.
+        bool hash_mapped (Generator &gen, int fd, size_t size) {
+            auto addr = ::mmap (nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                return false;
+            }
+            auto const *p = static_cast<const uint8_t *> (addr);
+#    ifdef MADV_SEQUENTIAL
+            ::madvise (addr, size, MADV_SEQUENTIAL);
+#    endif
+#    ifdef MADV_HUGEPAGE
+            // Only effective for the file systems supporting the huge page cache.
+            ::madvise (addr, size, MADV_HUGEPAGE);
+#    endif
+            for (size_t off = 0; off < size; off += MAP_WINDOW) {
+                size_t n = std::min (MAP_WINDOW, size - off);
+#    ifdef MADV_WILLNEED
+                if (off + n < size) {
+                    auto const *next = p + off + n;
+                    ::madvise (const_cast<uint8_t *> (next), std::min (MAP_WINDOW, size - off - n), MADV_WILLNEED);
+                }
+#    endif
+                gen.Update (p + off, n);
+            }
+            ::munmap (addr, size);
+            return true;
+        }
+#endif /* TIGER_HAVE_POSIX_IO */
+    }  // namespace
+
+    HashFileResult HashFile (const std::string &path, const HashFileOptions &options) {
+        auto const start = std::chrono::steady_clock::now ();
+
+        auto const &sbox = options.sbox != nullptr ? *options.sbox : DefaultSBox ();
+
+        HashFileResult result;
+        Generator      gen (sbox, options.passes, options.padding == Padding::Tiger2);
+
+        auto sink = [&gen, &result] (const uint8_t *data, size_t size) {
+            gen.Update (data, size);
+            result.size += size;
+        };
+
+#ifdef TIGER_HAVE_POSIX_IO
+        FileDescriptor fd {::open (path.c_str (), O_RDONLY | O_CLOEXEC)};
+        if (fd.Get () < 0) {
+            throw_errno (errno, path);
+        }
+        struct stat st {};
+        if (::fstat (fd.Get (), &st) != 0) {
+            throw_errno (errno, path);
+        }
+        if (options.useMmap && S_ISREG (st.st_mode) && 0 < st.st_size) {
+            auto size = static_cast<size_t> (st.st_size);
+            if (hash_mapped (gen, fd.Get (), size)) {
+                result.size   = size;
+                result.mapped = true;
+            }
+        }
+        if (! result.mapped) {
+#    ifdef POSIX_FADV_SEQUENTIAL
+            if (S_ISREG (st.st_mode)) {
+                ::posix_fadvise (fd.Get (), 0, 0, POSIX_FADV_SEQUENTIAL);
+            }
+#    endif
+            ReadAhead reader (
+                [&fd] (uint8_t *buffer, size_t size) -> ptrdiff_t {
+                    for (;;) {
+                        auto n = ::read (fd.Get (), buffer, size);
+                        if (0 <= n) {
+                            return n;
+                        }
+                        if (errno != EINTR) {
+                            return -errno;
+                        }
+                    }
+                },
+                options.bufferSize,
+                options.cntBuffer);
+            if (auto err = reader.Drain (sink)) {
+                throw_errno (err, path);
+            }
+        }
+#else
+        std::unique_ptr<std::FILE, int (*) (std::FILE *)> fp {std::fopen (path.c_str (), "rb"), &std::fclose};
+        if (! fp) {
+            throw_errno (errno, path);
+        }
+        ReadAhead reader (
+            [&fp] (uint8_t *buffer, size_t size) -> ptrdiff_t {
+                auto n = std::fread (buffer, 1, size, fp.get ());
+                if (n == 0 && std::ferror (fp.get ())) {
+                    return -EIO;
+                }
+                return static_cast<ptrdiff_t> (n);
+            },
+            options.bufferSize,
+            options.cntBuffer);
+        if (auto err = reader.Drain (sink)) {
+            throw_errno (err, path);
+        }
+#endif
+        result.digest  = gen.Finalize ();
+        result.seconds = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+        return result;
+    }
+
+    FileTail::FileTail (const std::string &path, const HashFileOptions &options)
+            : path_ {path}
+            , options_ {options}
+            , gen_ {options.sbox != nullptr ? *options.sbox : DefaultSBox (), options.passes, options.padding == Padding::Tiger2} {
+        /* NO-OP */
+    }
+
+    FileTailResult FileTail::Refresh () {
+        FileTailResult       result;
+        std::vector<uint8_t> buffer (std::max<size_t> (1, options_.bufferSize));
+
+        auto restart = [this, &result] () {
+            gen_.Reset ();
+            result.restarted = true;
+        };
+#ifdef TIGER_HAVE_POSIX_IO
+        FileDescriptor fd {::open (path_.c_str (), O_RDONLY | O_CLOEXEC)};
+        if (fd.Get () < 0) {
+            throw_errno (errno, path_);
+        }
+        struct stat st {};
+        if (::fstat (fd.Get (), &st) != 0) {
+            throw_errno (errno, path_);
+        }
+        auto const device = static_cast<uint64_t> (st.st_dev);
+        auto const inode  = static_cast<uint64_t> (st.st_ino);
+        if ((known_ && (device != device_ || inode != inode_)) || static_cast<uint64_t> (st.st_size) < gen_.Count ()) {
+            restart ();
+        }
+        device_ = device;
+        inode_  = inode;
+        known_  = true;
+        for (;;) {
+            auto n = ::pread (fd.Get (), buffer.data (), buffer.size (), static_cast<off_t> (gen_.Count ()));
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw_errno (errno, path_);
+            }
+            if (n == 0) {
+                break;
+            }
+            gen_.Update (buffer.data (), static_cast<size_t> (n));
+            result.appended += static_cast<uint64_t> (n);
+        }
+#else
+        std::unique_ptr<std::FILE, int (*) (std::FILE *)> fp {std::fopen (path_.c_str (), "rb"), &std::fclose};
+        if (! fp) {
+            throw_errno (errno, path_);
+        }
+        std::fseek (fp.get (), 0, SEEK_END);
+        if (static_cast<uint64_t> (std::ftell (fp.get ())) < gen_.Count ()) {
+            restart ();
+        }
+        std::fseek (fp.get (), static_cast<long> (gen_.Count ()), SEEK_SET);
+        for (;;) {
+            auto n = std::fread (buffer.data (), 1, buffer.size (), fp.get ());
+            if (n == 0) {
+                if (std::ferror (fp.get ())) {
+                    throw_errno (EIO, path_);
+                }
+                break;
+            }
+            gen_.Update (buffer.data (), n);
+            result.appended += n;
+        }
+#endif
+        result.size   = gen_.Count ();
+        result.digest = gen_.Peek ();
+        return result;
+    }
+}  // namespace Tiger
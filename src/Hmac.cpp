@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Hmac.hpp"
+
+#include "Internal.hpp"
+#include "Kernels.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Tiger {
+    using namespace internal;
+
+    namespace {
+        const uint8_t IPAD = 0x36;
+        const uint8_t OPAD = 0x5C;
+
+        /// # of messages hashed per stage by the batch.
+        const size_t STAGE_SIZE = 64;
+
+        /// Clears the key material (not elided as a dead store).
+        void wipe (void *data, size_t size) noexcept {
+            auto p = static_cast<volatile uint8_t *> (data);
+            for (size_t i = 0; i < size; ++i) {
+                p[i] = 0;
+            }
+        }
+
+        /// Compresses a message from the STATE after PREFIX bytes.
+        void compress_from (state_t &state, const sbox_t &sbox, size_t passes, const void *data, size_t size, uint64_t prefix, bool isTiger2) noexcept {
+            if (passes == DEFAULT_PASSES) {
+                compress_message (data, size, prefix, isTiger2, [&state, &sbox] (const msgblock_t &block) {
+                    CompressPasses<DEFAULT_PASSES> (state, block, sbox);
+                });
+            }
+            else {
+                compress_message (data, size, prefix, isTiger2, [&state, &sbox, passes] (const msgblock_t &block) {
+                    Compress (state, block, sbox, passes);
+                });
+            }
+        }
+    }  // namespace
+
+    const size_t Hmac::BLOCK_SIZE;
+
+    Hmac::Hmac (const sbox_t &sbox, const void *key, size_t keySize, size_t cntPass, Padding padding) noexcept
+            : sbox_ {sbox}
+            , cntPass_ {std::max (DEFAULT_PASSES, cntPass)}
+            , isTiger2_ {padding == Padding::Tiger2}
+            , inner_ {{init_state_0, init_state_1, init_state_2}}
+            , outer_ {{init_state_0, init_state_1, init_state_2}} {
+        uint8_t k[BLOCK_SIZE] = {};
+        if (BLOCK_SIZE < keySize) {
+            state_t state {{init_state_0, init_state_1, init_state_2}};
+            compress_from (state, sbox_, cntPass_, key, keySize, 0, isTiger2_);
+            auto const digest = make_digest (state);
+            ::memcpy (k, digest.data (), digest.size ());
+        }
+        else if (0 < keySize) {
+            ::memcpy (k, key, keySize);
+        }
+        msgblock_t block;
+        uint8_t    pad[BLOCK_SIZE];
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            pad[i] = static_cast<uint8_t> (k[i] ^ IPAD);
+        }
+        load_block (block, pad);
+        Compress (inner_, block, sbox_, cntPass_);
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            pad[i] = static_cast<uint8_t> (k[i] ^ OPAD);
+        }
+        load_block (block, pad);
+        Compress (outer_, block, sbox_, cntPass_);
+
+        wipe (k, sizeof (k));
+        wipe (pad, sizeof (pad));
+        wipe (&block, sizeof (block));
+    }
+
+    digest_t Hmac::Mac (const void *data, size_t size) const noexcept {
+        auto inner = inner_;
+        compress_from (inner, sbox_, cntPass_, data, size, BLOCK_SIZE, isTiger2_);
+        auto const digest = make_digest (inner);
+
+        auto outer = outer_;
+        compress_from (outer, sbox_, cntPass_, digest.data (), digest.size (), BLOCK_SIZE, isTiger2_);
+        return make_digest (outer);
+    }
+
+    void Hmac::Mac (digest_t *result, const ByteView *inputs, size_t count) const noexcept {
+        std::array<digest_t, STAGE_SIZE>     inner;
+        std::array<const void *, STAGE_SIZE> data;
+        std::array<size_t, STAGE_SIZE>       sizes;
+
+        for (size_t off = 0; off < count; off += STAGE_SIZE) {
+            size_t n = std::min (STAGE_SIZE, count - off);
+            for (size_t i = 0; i < n; ++i) {
+                data[i]  = inputs[off + i].data;
+                sizes[i] = inputs[off + i].size;
+            }
+            hash_lanes<8> (inner.data (), data.data (), sizes.data (), n, sbox_, cntPass_, isTiger2_, inner_, BLOCK_SIZE);
+            for (size_t i = 0; i < n; ++i) {
+                data[i]  = inner[i].data ();
+                sizes[i] = inner[i].size ();
+            }
+            hash_lanes<8> (result + off, data.data (), sizes.data (), n, sbox_, cntPass_, isTiger2_, outer_, BLOCK_SIZE);
+        }
+    }
+
+    bool Hmac::Verify (const digest_t &mac, const void *data, size_t size) const noexcept {
+        return DigestEqual (mac, Mac (data, size));
+    }
+
+    bool DigestEqual (const digest_t &a, const digest_t &b) noexcept {
+        volatile uint8_t diff = 0;
+        for (size_t i = 0; i < a.size (); ++i) {
+            diff = static_cast<uint8_t> (diff | (a[i] ^ b[i]));
+        }
+        return diff == 0;
+    }
+}  // namespace Tiger
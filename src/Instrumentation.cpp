@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Instrumentation.hpp"
+
+#include "Probes.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(TIGER_ENABLE_INSTRUMENTATION) && defined(__has_include)
+#    if __has_include(<sys/sdt.h>)
+#        include <sys/sdt.h>
+#        define TIGER_HAVE_USDT 1
+#    endif
+#endif
+
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+extern "C" {
+#    if defined(__GNUC__) || defined(__clang__)
+__attribute__ ((noinline, visibility ("default")))
+#    endif
+void tiger_probe_compress (uint64_t blocks, uint64_t cycles) {
+#    ifdef TIGER_HAVE_USDT
+    DTRACE_PROBE2 (tiger, compress, blocks, cycles);
+#    else
+    // Keeps the call (and its arguments) as the uprobe attach point (not a barrier to the caller).
+    asm volatile ("" : : "r"(blocks), "r"(cycles));
+#    endif
+}
+}
+#endif
+
+namespace Tiger {
+    Counters &Counters::operator+= (const Counters &other) noexcept {
+        blocks += other.blocks;
+        bytes += other.bytes;
+        updates += other.updates;
+        finalizes += other.finalizes;
+        cycles += other.cycles;
+        for (size_t i = 0; i < updateSizes.size (); ++i) {
+            updateSizes[i] += other.updateSizes[i];
+        }
+        return *this;
+    }
+
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+    namespace internal {
+        std::atomic<bool> cycle_timing {false};
+
+        Counters LocalCounters::Load () const noexcept {
+            Counters result;
+            result.blocks    = blocks.load (std::memory_order_relaxed);
+            result.bytes     = bytes.load (std::memory_order_relaxed);
+            result.updates   = updates.load (std::memory_order_relaxed);
+            result.finalizes = finalizes.load (std::memory_order_relaxed);
+            result.cycles    = cycles.load (std::memory_order_relaxed);
+            for (size_t i = 0; i < updateSizes.size (); ++i) {
+                result.updateSizes[i] = updateSizes[i].load (std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        void LocalCounters::Clear () noexcept {
+            blocks.store (0, std::memory_order_relaxed);
+            bytes.store (0, std::memory_order_relaxed);
+            updates.store (0, std::memory_order_relaxed);
+            finalizes.store (0, std::memory_order_relaxed);
+            cycles.store (0, std::memory_order_relaxed);
+            for (auto &v : updateSizes) {
+                v.store (0, std::memory_order_relaxed);
+            }
+        }
+
+        namespace {
+            /** Keeps track of the counters of the live threads.  */
+            struct Registry {
+                std::mutex                                               mutex;
+                std::vector<std::pair<std::thread::id, LocalCounters *>> threads;
+                Counters                                                 retired;  ///< Sum of the exited threads
+            };
+
+            Registry &registry () {
+                // Leaked: The threads may exit after the static destruction.
+                static auto *result = new Registry;
+                return *result;
+            }
+
+            /** Registers the counters of a thread for its lifetime.  */
+            struct Registration {
+                LocalCounters counters;
+
+                Registration () {
+                    auto                       &r = registry ();
+                    std::lock_guard<std::mutex> lock (r.mutex);
+                    r.threads.emplace_back (std::this_thread::get_id (), &counters);
+                }
+
+                ~Registration () {
+                    auto                       &r = registry ();
+                    std::lock_guard<std::mutex> lock (r.mutex);
+                    r.retired += counters.Load ();
+                    r.threads.erase (std::remove_if (r.threads.begin (),
+                                                     r.threads.end (),
+                                                     [this] (const std::pair<std::thread::id, LocalCounters *> &v) { return v.second == &counters; }),
+                                     r.threads.end ());
+                }
+            };
+        }  // namespace
+
+        LocalCounters &thread_counters () noexcept {
+            thread_local Registration registration;
+            return registration.counters;
+        }
+    }  // namespace internal
+#endif /* TIGER_ENABLE_INSTRUMENTATION */
+
+    bool InstrumentationEnabled () noexcept {
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void EnableCycleTiming (bool enable) noexcept {
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+        internal::cycle_timing.store (enable, std::memory_order_relaxed);
+#else
+        (void)enable;
+#endif
+    }
+
+    Counters ThreadCounters () noexcept {
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+        return internal::thread_counters ().Load ();
+#else
+        return Counters {};
+#endif
+    }
+
+    Counters CollectCounters () noexcept {
+        Counters result;
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+        auto                       &r = internal::registry ();
+        std::lock_guard<std::mutex> lock (r.mutex);
+        result = r.retired;
+        for (auto const &t : r.threads) {
+            result += t.second->Load ();
+        }
+#endif
+        return result;
+    }
+
+    void VisitCounters (const std::function<void (std::thread::id id, const Counters &counters)> &visitor) {
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+        auto                       &r = internal::registry ();
+        std::lock_guard<std::mutex> lock (r.mutex);
+        for (auto const &t : r.threads) {
+            visitor (t.first, t.second->Load ());
+        }
+#else
+        (void)visitor;
+#endif
+    }
+
+    void ResetCounters () noexcept {
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+        auto                       &r = internal::registry ();
+        std::lock_guard<std::mutex> lock (r.mutex);
+        r.retired = Counters {};
+        for (auto const &t : r.threads) {
+            t.second->Clear ();
+        }
+#endif
+    }
+}  // namespace Tiger
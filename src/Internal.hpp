@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Internals shared among the Tiger implementation units.
+#pragma once
+
+#include "Tiger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#    include <stdlib.h>
+#endif
+
+//#define FORCE_RUNTIME_BYTEORDER_CHECKING
+
+#if defined(__GNUC__) || defined(__clang__)
+/// Inlines every call in the function (keeps the lanes of `CompressLanes` in one body).
+#    define TIGER_FLATTEN __attribute__ ((flatten))
+#else
+#    define TIGER_FLATTEN
+#endif
+
+namespace Tiger { namespace internal {
+
+    const uint64_t init_state_0 = 0x0123456789ABCDEFuLL;
+    const uint64_t init_state_1 = 0xFEDCBA9876543210uLL;
+    const uint64_t init_state_2 = 0xF096A5B4C3B2E187uLL;
+    const uint64_t schedule_0   = 0xA5A5A5A5A5A5A5A5uLL;
+    const uint64_t schedule_1   = 0x0123456789ABCDEFuLL;
+
+#ifndef FORCE_RUNTIME_BYTEORDER_CHECKING
+#    if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && defined(__ORDER_BIG_ENDIAN__)
+#        if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    const bool TARGET_LITTLE_ENDIAN = true;
+#        elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    const bool TARGET_LITTLE_ENDIAN = false;
+#        else
+#            define FORCE_RUNTIME_BYTEORDER_CHECKING 1
+#        endif
+#    endif
+#endif /* FORCE_RUNTIME_BYTEORDER_CHECKING */
+
+#ifdef FORCE_RUNTIME_BYTEORDER_CHECKING
+    inline bool check_little_endian () noexcept {
+        unsigned int val = 0x01020304;
+
+        auto p = reinterpret_cast<const uint8_t *> (&val);
+
+        if (p[0] == 0x04 && p[1] == 0x03 && p[2] == 0x02 && p[3] == 0x01) {
+            return true;
+        }
+        else if (p[3] == 0x04 && p[2] == 0x03 && p[1] == 0x02 && p[0] == 0x01) {
+            return false;
+        }
+        assert (false);
+        return false;
+    }
+    const bool TARGET_LITTLE_ENDIAN = check_little_endian ();
+#endif /* FORCE_RUNTIME_BYTEORDER_CHECKING */
+
+    inline uint64_t as_uint64 (const void *addr) {
+        auto const *p = static_cast<const uint8_t *> (addr);
+        // clang-format off
+        return ( (static_cast<uint64_t> (p[0]) <<  0u)
+               | (static_cast<uint64_t> (p[1]) <<  8u)
+               | (static_cast<uint64_t> (p[2]) << 16u)
+               | (static_cast<uint64_t> (p[3]) << 24u)
+               | (static_cast<uint64_t> (p[4]) << 32u)
+               | (static_cast<uint64_t> (p[5]) << 40u)
+               | (static_cast<uint64_t> (p[6]) << 48u)
+               | (static_cast<uint64_t> (p[7]) << 56u)
+               );
+        // clang-format on
+    }
+
+    inline std::array<uint64_t, 8> make_work (const void *seed, size_t size) {
+        std::array<uint8_t, 64> tmp;
+
+        tmp.fill (0);
+        ::memcpy (tmp.data (), seed, std::min (size, tmp.size ()));
+        // clang-format off
+        return std::array<uint64_t, 8> {{ as_uint64 (&tmp[8 * 0])
+                                        , as_uint64 (&tmp[8 * 1])
+                                        , as_uint64 (&tmp[8 * 2])
+                                        , as_uint64 (&tmp[8 * 3])
+                                        , as_uint64 (&tmp[8 * 4])
+                                        , as_uint64 (&tmp[8 * 5])
+                                        , as_uint64 (&tmp[8 * 6])
+                                        , as_uint64 (&tmp[8 * 7])
+                                        }};
+        // clang-format on
+    }
+
+    /// Reverses the byte order of the VALUE.
+    inline uint64_t bswap64 (uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap64 (value);
+#elif defined(_MSC_VER)
+        return _byteswap_uint64 (value);
+#else
+        value = ((value & 0x00FF00FF00FF00FFuLL) << 8u) | ((value >> 8u) & 0x00FF00FF00FF00FFuLL);
+        value = ((value & 0x0000FFFF0000FFFFuLL) << 16u) | ((value >> 16u) & 0x0000FFFF0000FFFFuLL);
+        return (value << 32u) | (value >> 32u);
+#endif
+    }
+
+    /// Loads a little-endian 64bit word from the (possibly unaligned) ADDR.
+    inline uint64_t load_le64 (const void *addr) noexcept {
+        uint64_t v;
+        ::memcpy (&v, addr, sizeof (v));
+        return TARGET_LITTLE_ENDIAN ? v : bswap64 (v);
+    }
+
+    /// Loads the 64 bytes message block from the (possibly unaligned) ADDR.
+    inline void load_block (Tiger::msgblock_t &block, const void *addr) noexcept {
+        ::memcpy (&block[0], addr, sizeof (block));
+        if (! TARGET_LITTLE_ENDIAN) {
+            for (auto &v : block) {
+                v = bswap64 (v);
+            }
+        }
+    }
+
+    /// Stores the VALUE in little-endian to the (possibly unaligned) RESULT.
+    inline void to_bytes (uint8_t *result, uint64_t value) {
+        if (! TARGET_LITTLE_ENDIAN) {
+            value = bswap64 (value);
+        }
+        ::memcpy (result, &value, sizeof (value));
+    }
+
+    inline void round (const Tiger::sbox_t &sbox, uint64_t &a, uint64_t &b, uint64_t &c, uint64_t x, uint64_t mul) {
+        c ^= x;
+        // clang-format off
+        auto const c0 = static_cast<uint8_t> (c >>  0u);
+        auto const c1 = static_cast<uint8_t> (c >>  8u);
+        auto const c2 = static_cast<uint8_t> (c >> 16u);
+        auto const c3 = static_cast<uint8_t> (c >> 24u);
+        auto const c4 = static_cast<uint8_t> (c >> 32u);
+        auto const c5 = static_cast<uint8_t> (c >> 40u);
+        auto const c6 = static_cast<uint8_t> (c >> 48u);
+        auto const c7 = static_cast<uint8_t> (c >> 56u);
+        // clang-format on
+
+        a -= (sbox[0 * 256 + c0] ^ sbox[1 * 256 + c2] ^ sbox[2 * 256 + c4] ^ sbox[3 * 256 + c6]);
+        b += (sbox[3 * 256 + c1] ^ sbox[2 * 256 + c3] ^ sbox[1 * 256 + c5] ^ sbox[0 * 256 + c7]);
+        b *= mul;
+    }
+
+    inline void Compress (state_t &state, const msgblock_t &input, const sbox_t &sbox, size_t passes) noexcept {
+        uint_fast64_t a = state[0];
+        uint_fast64_t b = state[1];
+        uint_fast64_t c = state[2];
+
+        uint_fast64_t x0 = input[0];
+        uint_fast64_t x1 = input[1];
+        uint_fast64_t x2 = input[2];
+        uint_fast64_t x3 = input[3];
+        uint_fast64_t x4 = input[4];
+        uint_fast64_t x5 = input[5];
+        uint_fast64_t x6 = input[6];
+        uint_fast64_t x7 = input[7];
+
+        auto schedule = [&x0, &x1, &x2, &x3, &x4, &x5, &x6, &x7] () {
+            x0 -= x7 ^ schedule_0;
+            x1 ^= x0;
+            x2 += x1;
+            x3 -= x2 ^ ((~x1) << 19u);
+            x4 ^= x3;
+            x5 += x4;
+            x6 -= x5 ^ ((~x4) >> 23u);
+            x7 ^= x6;
+            x0 += x7;
+            x1 -= x0 ^ ((~x7) << 19u);
+            x2 ^= x1;
+            x3 += x2;
+            x4 -= x3 ^ ((~x2) >> 23u);
+            x5 ^= x4;
+            x6 += x5;
+            x7 -= x6 ^ schedule_1;
+        };
+
+        auto pass = [&] (const sbox_t &S, uint64_t &A, uint64_t &B, uint64_t &C, uint64_t MUL) {
+            round (S, A, B, C, x0, MUL);
+            round (S, B, C, A, x1, MUL);
+            round (S, C, A, B, x2, MUL);
+            round (S, A, B, C, x3, MUL);
+            round (S, B, C, A, x4, MUL);
+            round (S, C, A, B, x5, MUL);
+            round (S, A, B, C, x6, MUL);
+            round (S, B, C, A, x7, MUL);
+        };
+
+        pass (sbox, a, b, c, 5);
+        schedule ();
+        pass (sbox, c, a, b, 7);
+        schedule ();
+        pass (sbox, b, c, a, 9);
+
+        for (size_t cnt = 3; cnt < passes; ++cnt) {
+            schedule ();
+            pass (sbox, a, b, c, 9);
+
+            auto tmp = a;
+            a        = c;
+            c        = b;
+            b        = tmp;
+        }
+        state[0] = a ^ state[0];
+        state[1] = b - state[1];
+        state[2] = c + state[2];
+    }
+
+    /// Applies N_ extra passes, rotating the registers by renaming them.
+    template <size_t N_>
+    struct ExtraPasses {
+        template <typename Schedule_, typename Pass_, typename Final_>
+        static void Apply (uint64_t &a, uint64_t &b, uint64_t &c, Schedule_ &schedule, Pass_ &pass, Final_ &feed) {
+            schedule ();
+            pass (a, b, c, 9);
+            ExtraPasses<N_ - 1>::Apply (c, a, b, schedule, pass, feed);
+        }
+    };
+
+    template <>
+    struct ExtraPasses<0> {
+        template <typename Schedule_, typename Pass_, typename Final_>
+        static void Apply (uint64_t &a, uint64_t &b, uint64_t &c, Schedule_ &, Pass_ &, Final_ &feed) {
+            feed (a, b, c);
+        }
+    };
+
+    /**
+     * The compression function with the # of passes fixed at the compile time.
+     *
+     * Fully unrolled: The extra passes are expanded and their register
+     * rotation is resolved by renaming.
+     *
+     * @remarks Fewer than DEFAULT_PASSES is not Tiger any more (only for `TableHash`).
+     */
+    template <size_t PASSES_>
+    inline void CompressPasses (state_t &state, const msgblock_t &input, const sbox_t &sbox) noexcept {
+        static_assert (0 < PASSES_, "Requires a pass at least");
+
+        uint64_t a = state[0];
+        uint64_t b = state[1];
+        uint64_t c = state[2];
+
+        uint64_t x0 = input[0];
+        uint64_t x1 = input[1];
+        uint64_t x2 = input[2];
+        uint64_t x3 = input[3];
+        uint64_t x4 = input[4];
+        uint64_t x5 = input[5];
+        uint64_t x6 = input[6];
+        uint64_t x7 = input[7];
+
+        auto schedule = [&x0, &x1, &x2, &x3, &x4, &x5, &x6, &x7] () {
+            x0 -= x7 ^ schedule_0;
+            x1 ^= x0;
+            x2 += x1;
+            x3 -= x2 ^ ((~x1) << 19u);
+            x4 ^= x3;
+            x5 += x4;
+            x6 -= x5 ^ ((~x4) >> 23u);
+            x7 ^= x6;
+            x0 += x7;
+            x1 -= x0 ^ ((~x7) << 19u);
+            x2 ^= x1;
+            x3 += x2;
+            x4 -= x3 ^ ((~x2) >> 23u);
+            x5 ^= x4;
+            x6 += x5;
+            x7 -= x6 ^ schedule_1;
+        };
+
+        auto pass = [&] (uint64_t &A, uint64_t &B, uint64_t &C, uint64_t MUL) {
+            round (sbox, A, B, C, x0, MUL);
+            round (sbox, B, C, A, x1, MUL);
+            round (sbox, C, A, B, x2, MUL);
+            round (sbox, A, B, C, x3, MUL);
+            round (sbox, B, C, A, x4, MUL);
+            round (sbox, C, A, B, x5, MUL);
+            round (sbox, A, B, C, x6, MUL);
+            round (sbox, B, C, A, x7, MUL);
+        };
+
+        auto feed = [&state] (uint64_t A, uint64_t B, uint64_t C) {
+            state[0] = A ^ state[0];
+            state[1] = B - state[1];
+            state[2] = C + state[2];
+        };
+
+        pass (a, b, c, 5);
+        if (1 < PASSES_) {
+            schedule ();
+            pass (c, a, b, 7);
+        }
+        if (2 < PASSES_) {
+            schedule ();
+            pass (b, c, a, 9);
+        }
+        ExtraPasses<(DEFAULT_PASSES < PASSES_ ? PASSES_ - DEFAULT_PASSES : 0)>::Apply (a, b, c, schedule, pass, feed);
+    }
+
+    /**
+     * Compresses N_ independent blocks in lockstep.
+     *
+     * Each round is issued for all lanes before the next one, so the S-box
+     * lookups of the independent lanes overlap with each other.
+     */
+    template <size_t N_>
+    inline void CompressLanes (state_t *state, const msgblock_t *input, const sbox_t &sbox, size_t passes) noexcept {
+        uint64_t a[N_];
+        uint64_t b[N_];
+        uint64_t c[N_];
+        uint64_t x[8][N_];
+
+        for (size_t k = 0; k < N_; ++k) {
+            a[k] = state[k][0];
+            b[k] = state[k][1];
+            c[k] = state[k][2];
+            for (size_t i = 0; i < 8; ++i) {
+                x[i][k] = input[k][i];
+            }
+        }
+
+        auto schedule = [&x] () {
+            for (size_t k = 0; k < N_; ++k) {
+                x[0][k] -= x[7][k] ^ schedule_0;
+                x[1][k] ^= x[0][k];
+                x[2][k] += x[1][k];
+                x[3][k] -= x[2][k] ^ ((~x[1][k]) << 19u);
+                x[4][k] ^= x[3][k];
+                x[5][k] += x[4][k];
+                x[6][k] -= x[5][k] ^ ((~x[4][k]) >> 23u);
+                x[7][k] ^= x[6][k];
+                x[0][k] += x[7][k];
+                x[1][k] -= x[0][k] ^ ((~x[7][k]) << 19u);
+                x[2][k] ^= x[1][k];
+                x[3][k] += x[2][k];
+                x[4][k] -= x[3][k] ^ ((~x[2][k]) >> 23u);
+                x[5][k] ^= x[4][k];
+                x[6][k] += x[5][k];
+                x[7][k] -= x[6][k] ^ schedule_1;
+            }
+        };
+
+        auto rounds = [&sbox] (uint64_t(&A)[N_], uint64_t(&B)[N_], uint64_t(&C)[N_], const uint64_t(&X)[N_], uint64_t MUL) {
+            for (size_t k = 0; k < N_; ++k) {
+                round (sbox, A[k], B[k], C[k], X[k], MUL);
+            }
+        };
+
+        auto pass = [&] (uint64_t(&A)[N_], uint64_t(&B)[N_], uint64_t(&C)[N_], uint64_t MUL) {
+            rounds (A, B, C, x[0], MUL);
+            rounds (B, C, A, x[1], MUL);
+            rounds (C, A, B, x[2], MUL);
+            rounds (A, B, C, x[3], MUL);
+            rounds (B, C, A, x[4], MUL);
+            rounds (C, A, B, x[5], MUL);
+            rounds (A, B, C, x[6], MUL);
+            rounds (B, C, A, x[7], MUL);
+        };
+
+        pass (a, b, c, 5);
+        schedule ();
+        pass (c, a, b, 7);
+        schedule ();
+        pass (b, c, a, 9);
+
+        for (size_t cnt = 3; cnt < passes; ++cnt) {
+            schedule ();
+            pass (a, b, c, 9);
+
+            for (size_t k = 0; k < N_; ++k) {
+                auto tmp = a[k];
+                a[k]     = c[k];
+                c[k]     = b[k];
+                b[k]     = tmp;
+            }
+        }
+        for (size_t k = 0; k < N_; ++k) {
+            state[k][0] = a[k] ^ state[k][0];
+            state[k][1] = b[k] - state[k][1];
+            state[k][2] = c[k] + state[k][2];
+        }
+    }
+
+    /**
+     * Builds the padded final block(s) of a message.
+     *
+     * @param result    Receives the final block(s)
+     * @param tail      The trailing bytes not yet compressed
+     * @param tail_size # of bytes in the TAIL (< 64)
+     * @param total     # of bytes in the whole message
+     * @param isTiger2  Use Tiger2 padding
+     *
+     * @return # of blocks stored in the RESULT (1 or 2)
+     */
+    inline size_t make_final_blocks (uint8_t (&result)[2 * sizeof (msgblock_t)],
+                                     const void *tail,
+                                     size_t      tail_size,
+                                     uint64_t    total,
+                                     bool        isTiger2) noexcept {
+        assert (tail_size < sizeof (msgblock_t));
+        size_t cntBlock = (tail_size < sizeof (msgblock_t) - 8) ? 1 : 2;
+        size_t size     = cntBlock * sizeof (msgblock_t);
+
+        if (0 < tail_size) {
+            ::memcpy (result, tail, tail_size);
+        }
+        result[tail_size] = isTiger2 ? 0x80 : 0x01;
+        ::memset (result + tail_size + 1, 0, size - 8 - (tail_size + 1));
+        to_bytes (result + size - 8, 8 * total);
+        return cntBlock;
+    }
+
+    /**
+     * Feeds bytes into a buffered message state.
+     *
+     * Fills the pending block first, then compresses full blocks straight
+     * from the DATA and buffers the tail.
+     *
+     * @param buffer   Pending bytes in the input order
+     * @param count    # of bytes fed so far
+     * @param data     The input sequence
+     * @param size     # of bytes in the input sequence
+     * @param compress Compresses a block (`void (const msgblock_t &)`)
+     */
+    template <typename Compress_>
+    inline void update_buffered (msgblock_t &buffer, size_t &count, const void *data, size_t size, Compress_ &&compress) noexcept {
+        auto       p   = static_cast<const uint8_t *> (data);
+        auto       q   = reinterpret_cast<uint8_t *> (&buffer[0]);
+        size_t     idx = count & 0x3Fu;
+        msgblock_t block;
+
+        count += size;
+        if (0 < idx) {
+            size_t n = std::min (size, sizeof (buffer) - idx);
+            ::memcpy (q + idx, p, n);
+            p += n;
+            size -= n;
+            if (idx + n < sizeof (buffer)) {
+                return;
+            }
+            load_block (block, q);
+            compress (block);
+        }
+        while (sizeof (block) <= size) {
+            load_block (block, p);
+            compress (block);
+            p += sizeof (block);
+            size -= sizeof (block);
+        }
+        if (0 < size) {
+            ::memcpy (q, p, size);
+        }
+    }
+
+    /// Feeds a byte into a buffered message state.
+    template <typename Compress_>
+    inline void update_buffered (msgblock_t &buffer, size_t &count, uint8_t value, Compress_ &&compress) noexcept {
+        auto q = reinterpret_cast<uint8_t *> (&buffer[0]);
+
+        q[count & 0x3Fu] = value;
+        ++count;
+        if ((count & 0x3Fu) == 0) {
+            msgblock_t block;
+            load_block (block, q);
+            compress (block);
+        }
+    }
+
+    /// Pads the buffered message state and compresses the final block(s).
+    template <typename Compress_>
+    inline void finalize_buffered (const msgblock_t &buffer, size_t count, bool isTiger2, Compress_ &&compress) noexcept {
+        uint8_t    tmp[2 * sizeof (msgblock_t)];
+        msgblock_t block;
+
+        auto cntBlock = make_final_blocks (tmp, &buffer[0], count & 0x3Fu, count, isTiger2);
+        for (size_t i = 0; i < cntBlock; ++i) {
+            load_block (block, &tmp[sizeof (block) * i]);
+            compress (block);
+        }
+    }
+
+    /**
+     * Compresses a whole message (including the final blocks) without buffering.
+     *
+     * @param data     The message
+     * @param size     # of bytes in the message
+     * @param prefix   # of bytes compressed before the DATA (a multiple of 64)
+     * @param isTiger2 Use Tiger2 padding
+     * @param compress Compresses a block (`void (const msgblock_t &)`)
+     */
+    template <typename Compress_>
+    inline void compress_message (const void *data, size_t size, uint64_t prefix, bool isTiger2, Compress_ &&compress) noexcept {
+        auto       p       = static_cast<const uint8_t *> (data);
+        size_t     cntFull = size / sizeof (msgblock_t);
+        msgblock_t block;
+
+        for (size_t i = 0; i < cntFull; ++i) {
+            load_block (block, p);
+            compress (block);
+            p += sizeof (block);
+        }
+        uint8_t tail[2 * sizeof (msgblock_t)];
+        size_t  cntFinal = make_final_blocks (tail, p, size % sizeof (msgblock_t), prefix + size, isTiger2);
+        for (size_t i = 0; i < cntFinal; ++i) {
+            load_block (block, &tail[sizeof (block) * i]);
+            compress (block);
+        }
+    }
+
+    /// Converts the chaining state into the digest.
+    inline digest_t make_digest (const state_t &state) noexcept {
+        digest_t result;
+        to_bytes (&result[0], state[0]);
+        to_bytes (&result[8], state[1]);
+        to_bytes (&result[16], state[2]);
+        return result;
+    }
+}}  // namespace Tiger::internal
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Kernel.hpp"
+
+#include "Internal.hpp"
+#include "Kernels.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace Tiger {
+    namespace internal {
+        namespace {
+            template <size_t N_>
+            TIGER_FLATTEN void compress_portable (state_t *state, const msgblock_t *input, const sbox_t &sbox, size_t passes) {
+                CompressLanes<N_> (state, input, sbox, passes);
+            }
+
+            bool cpu_supports (Kernel kernel) noexcept {
+#ifdef TIGER_HAVE_X86_KERNELS
+                __builtin_cpu_init ();
+                switch (kernel) {
+                case Kernel::Portable: return true;
+                case Kernel::SSE42: return __builtin_cpu_supports ("sse4.2") != 0;
+                case Kernel::AVX2: return __builtin_cpu_supports ("avx2") != 0;
+                case Kernel::AVX512: return __builtin_cpu_supports ("avx2") != 0 && __builtin_cpu_supports ("avx512f") != 0;
+                default: return false;
+                }
+#else
+                return kernel == Kernel::Portable;
+#endif
+            }
+
+            const KernelTable *find_kernel (Kernel kernel) noexcept {
+                if (! cpu_supports (kernel)) {
+                    return nullptr;
+                }
+                switch (kernel) {
+#ifdef TIGER_HAVE_X86_KERNELS
+                case Kernel::SSE42: return &sse42_kernel ();
+                case Kernel::AVX2: return &avx2_kernel ();
+                case Kernel::AVX512: return &avx512_kernel ();
+#endif
+                default: return &portable_kernel ();
+                }
+            }
+
+            /// Picks the preferred kernel available on this CPU.
+            /// The SSE4.2 and the AVX2 ones are not faster than the portable one (the 4 gathers
+            /// of `vpgatherqq` cost more than the interleaved scalar loads): Only selected explicitly.
+            const KernelTable *detect_kernel () noexcept {
+                if (auto result = find_kernel (Kernel::AVX512)) {
+                    return result;
+                }
+                return &portable_kernel ();
+            }
+
+            /// The kernel pinned by the `TIGER_KERNEL`, or the detected one.
+            const KernelTable *initial_kernel () noexcept {
+                if (auto name = ::getenv ("TIGER_KERNEL")) {
+                    for (auto kernel : {Kernel::Portable, Kernel::SSE42, Kernel::AVX2, Kernel::AVX512}) {
+                        if (::strcmp (name, KernelName (kernel)) == 0) {
+                            if (auto result = find_kernel (kernel)) {
+                                return result;
+                            }
+                        }
+                    }
+                }
+                return detect_kernel ();
+            }
+
+            std::atomic<const KernelTable *> &active_table () noexcept {
+                static std::atomic<const KernelTable *> table {initial_kernel ()};
+                return table;
+            }
+        }  // namespace
+
+        const KernelTable &portable_kernel () noexcept {
+            static const KernelTable kernel {Kernel::Portable, &compress_portable<2>, &compress_portable<4>, &compress_portable<8>};
+            return kernel;
+        }
+
+        const KernelTable &active_kernel () noexcept {
+            return *active_table ().load (std::memory_order_acquire);
+        }
+    }  // namespace internal
+
+    using namespace internal;
+
+    const char *KernelName (Kernel kernel) noexcept {
+        switch (kernel) {
+        case Kernel::Auto: return "auto";
+        case Kernel::Portable: return "portable";
+        case Kernel::SSE42: return "sse42";
+        case Kernel::AVX2: return "avx2";
+        case Kernel::AVX512: return "avx512";
+        }
+        return "unknown";
+    }
+
+    bool IsKernelAvailable (Kernel kernel) noexcept {
+        return kernel == Kernel::Auto || find_kernel (kernel) != nullptr;
+    }
+
+    Kernel ActiveKernel () noexcept {
+        return active_kernel ().kernel;
+    }
+
+    bool SelectKernel (Kernel kernel) noexcept {
+        auto table = (kernel == Kernel::Auto) ? detect_kernel () : find_kernel (kernel);
+        if (table == nullptr) {
+            return false;
+        }
+        active_table ().store (table, std::memory_order_release);
+        return true;
+    }
+}  // namespace Tiger
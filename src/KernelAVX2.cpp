@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Kernels.hpp"
+
+#ifdef TIGER_HAVE_X86_KERNELS
+
+#    include <immintrin.h>
+
+#    define TIGER_SIMD_TARGET __attribute__ ((target ("avx2")))
+
+#    include "KernelSimd.hpp"
+
+namespace Tiger { namespace internal {
+    namespace {
+        /** 4 lanes in a YMM register.  */
+        struct OpsAVX2 {
+            using vec_t               = __m256i;
+            static const size_t WIDTH = 4;
+
+            TIGER_SIMD_TARGET static vec_t load (const uint64_t *p) { return _mm256_loadu_si256 (reinterpret_cast<const __m256i *> (p)); }
+            TIGER_SIMD_TARGET static void  store (uint64_t *p, vec_t v) { _mm256_storeu_si256 (reinterpret_cast<__m256i *> (p), v); }
+            TIGER_SIMD_TARGET static vec_t set1 (uint64_t v) { return _mm256_set1_epi64x (static_cast<long long> (v)); }
+            TIGER_SIMD_TARGET static vec_t add (vec_t a, vec_t b) { return _mm256_add_epi64 (a, b); }
+            TIGER_SIMD_TARGET static vec_t sub (vec_t a, vec_t b) { return _mm256_sub_epi64 (a, b); }
+            TIGER_SIMD_TARGET static vec_t bxor (vec_t a, vec_t b) { return _mm256_xor_si256 (a, b); }
+            TIGER_SIMD_TARGET static vec_t band (vec_t a, vec_t b) { return _mm256_and_si256 (a, b); }
+
+            template <int N_>
+            TIGER_SIMD_TARGET static vec_t shl (vec_t a) {
+                return _mm256_slli_epi64 (a, N_);
+            }
+            template <int N_>
+            TIGER_SIMD_TARGET static vec_t shr (vec_t a) {
+                return _mm256_srli_epi64 (a, N_);
+            }
+
+            TIGER_SIMD_TARGET static vec_t lookup (const uint64_t *table, vec_t idx) {
+                return _mm256_i64gather_epi64 (reinterpret_cast<const long long *> (table), idx, 8);
+            }
+        };
+    }  // namespace
+
+    const KernelTable &avx2_kernel () noexcept {
+        static const KernelTable kernel {Kernel::AVX2,
+                                         portable_kernel ().compress2,
+                                         &compress_simd<OpsAVX2, 4>,
+                                         &compress_simd<OpsAVX2, 8>};
+        return kernel;
+    }
+}}  // namespace Tiger::internal
+
+#endif /* TIGER_HAVE_X86_KERNELS */
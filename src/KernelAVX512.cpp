@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Kernels.hpp"
+
+#ifdef TIGER_HAVE_X86_KERNELS
+
+#    include <immintrin.h>
+
+#    define TIGER_SIMD_TARGET __attribute__ ((target ("avx512f")))
+
+#    include "KernelSimd.hpp"
+
+namespace Tiger { namespace internal {
+    namespace {
+        /** 8 lanes in a ZMM register.  */
+        struct OpsAVX512 {
+            using vec_t               = __m512i;
+            static const size_t WIDTH = 8;
+
+            TIGER_SIMD_TARGET static vec_t load (const uint64_t *p) { return _mm512_loadu_si512 (p); }
+            TIGER_SIMD_TARGET static void  store (uint64_t *p, vec_t v) { _mm512_storeu_si512 (p, v); }
+            TIGER_SIMD_TARGET static vec_t set1 (uint64_t v) { return _mm512_set1_epi64 (static_cast<long long> (v)); }
+            TIGER_SIMD_TARGET static vec_t add (vec_t a, vec_t b) { return _mm512_add_epi64 (a, b); }
+            TIGER_SIMD_TARGET static vec_t sub (vec_t a, vec_t b) { return _mm512_sub_epi64 (a, b); }
+            TIGER_SIMD_TARGET static vec_t bxor (vec_t a, vec_t b) { return _mm512_xor_si512 (a, b); }
+            TIGER_SIMD_TARGET static vec_t band (vec_t a, vec_t b) { return _mm512_and_si512 (a, b); }
+
+            // Uses the masked forms: The plain ones expand to `_mm512_undefined_epi32 ()` which trips -Wuninitialized.
+            template <int N_>
+            TIGER_SIMD_TARGET static vec_t shl (vec_t a) {
+                return _mm512_maskz_slli_epi64 (0xFF, a, N_);
+            }
+            template <int N_>
+            TIGER_SIMD_TARGET static vec_t shr (vec_t a) {
+                return _mm512_maskz_srli_epi64 (0xFF, a, N_);
+            }
+
+            TIGER_SIMD_TARGET static vec_t lookup (const uint64_t *table, vec_t idx) {
+                return _mm512_mask_i64gather_epi64 (_mm512_setzero_si512 (), 0xFF, idx, table, 8);
+            }
+        };
+    }  // namespace
+
+    // 4 lanes are too narrow for a ZMM register and the AVX2 kernel is slower than the portable one.
+    const KernelTable &avx512_kernel () noexcept {
+        static const KernelTable kernel {Kernel::AVX512,
+                                         portable_kernel ().compress2,
+                                         portable_kernel ().compress4,
+                                         &compress_simd<OpsAVX512, 8>};
+        return kernel;
+    }
+}}  // namespace Tiger::internal
+
+#endif /* TIGER_HAVE_X86_KERNELS */
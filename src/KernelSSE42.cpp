@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Kernels.hpp"
+
+#ifdef TIGER_HAVE_X86_KERNELS
+
+#    include "Internal.hpp"
+
+namespace Tiger { namespace internal {
+    namespace {
+        /// The interleaved scalar kernel, flattened and compiled for SSE4.2 capable targets.
+        template <size_t N_>
+        __attribute__ ((target ("sse4.2"))) TIGER_FLATTEN void
+        compress_sse42 (state_t *state, const msgblock_t *input, const sbox_t &sbox, size_t passes) {
+            CompressLanes<N_> (state, input, sbox, passes);
+        }
+    }  // namespace
+
+    const KernelTable &sse42_kernel () noexcept {
+        static const KernelTable kernel {Kernel::SSE42, &compress_sse42<2>, &compress_sse42<4>, &compress_sse42<8>};
+        return kernel;
+    }
+}}  // namespace Tiger::internal
+
+#endif /* TIGER_HAVE_X86_KERNELS */
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Vectorized multi-lane compression function.
+///
+/// Included by the kernel units after defining `TIGER_SIMD_TARGET` (the
+/// function attribute enabling the instruction set) and an `Ops` class
+/// wrapping the vector intrinsics.
+#pragma once
+
+#include "Internal.hpp"
+#include "Tiger.hpp"
+
+#include <type_traits>
+
+#ifndef TIGER_SIMD_TARGET
+#    error "TIGER_SIMD_TARGET should be defined"
+#endif
+
+namespace Tiger { namespace internal { namespace {
+    template <typename Ops_, size_t V_>
+    class SimdCompressor {
+    public:
+        using vec_t               = typename Ops_::vec_t;
+        static const size_t WIDTH = Ops_::WIDTH;
+        static const size_t LANES = WIDTH * V_;
+
+    private:
+        const uint64_t *sbox_;
+        vec_t           x_[8][V_];
+
+    public:
+        TIGER_SIMD_TARGET explicit SimdCompressor (const sbox_t &sbox) : sbox_ {sbox.data ()} { /* NO-OP */
+        }
+
+        TIGER_SIMD_TARGET void Compress (state_t *state, const msgblock_t *input, size_t passes) {
+            vec_t a[V_];
+            vec_t b[V_];
+            vec_t c[V_];
+            vec_t s0[V_];
+            vec_t s1[V_];
+            vec_t s2[V_];
+
+            for (size_t v = 0; v < V_; ++v) {
+                uint64_t tmp[WIDTH];
+                for (size_t i = 0; i < 8; ++i) {
+                    for (size_t k = 0; k < WIDTH; ++k) {
+                        tmp[k] = input[WIDTH * v + k][i];
+                    }
+                    x_[i][v] = Ops_::load (tmp);
+                }
+                for (size_t k = 0; k < WIDTH; ++k) {
+                    tmp[k] = state[WIDTH * v + k][0];
+                }
+                s0[v] = a[v] = Ops_::load (tmp);
+                for (size_t k = 0; k < WIDTH; ++k) {
+                    tmp[k] = state[WIDTH * v + k][1];
+                }
+                s1[v] = b[v] = Ops_::load (tmp);
+                for (size_t k = 0; k < WIDTH; ++k) {
+                    tmp[k] = state[WIDTH * v + k][2];
+                }
+                s2[v] = c[v] = Ops_::load (tmp);
+            }
+
+            Pass<5> (a, b, c);
+            Schedule ();
+            Pass<7> (c, a, b);
+            Schedule ();
+            Pass<9> (b, c, a);
+
+            for (size_t cnt = 3; cnt < passes; ++cnt) {
+                Schedule ();
+                Pass<9> (a, b, c);
+
+                for (size_t v = 0; v < V_; ++v) {
+                    auto tmp = a[v];
+                    a[v]     = c[v];
+                    c[v]     = b[v];
+                    b[v]     = tmp;
+                }
+            }
+            for (size_t v = 0; v < V_; ++v) {
+                uint64_t ra[WIDTH];
+                uint64_t rb[WIDTH];
+                uint64_t rc[WIDTH];
+                Ops_::store (ra, Ops_::bxor (a[v], s0[v]));
+                Ops_::store (rb, Ops_::sub (b[v], s1[v]));
+                Ops_::store (rc, Ops_::add (c[v], s2[v]));
+                for (size_t k = 0; k < WIDTH; ++k) {
+                    state[WIDTH * v + k][0] = ra[k];
+                    state[WIDTH * v + k][1] = rb[k];
+                    state[WIDTH * v + k][2] = rc[k];
+                }
+            }
+        }
+
+    private:
+        TIGER_SIMD_TARGET static vec_t mul (vec_t b, std::integral_constant<int, 5>) {
+            return Ops_::add (Ops_::template shl<2> (b), b);
+        }
+        TIGER_SIMD_TARGET static vec_t mul (vec_t b, std::integral_constant<int, 7>) {
+            return Ops_::sub (Ops_::template shl<3> (b), b);
+        }
+        TIGER_SIMD_TARGET static vec_t mul (vec_t b, std::integral_constant<int, 9>) {
+            return Ops_::add (Ops_::template shl<3> (b), b);
+        }
+
+        TIGER_SIMD_TARGET vec_t lookup (size_t table, vec_t c, vec_t mask) const {
+            return Ops_::lookup (sbox_ + 256 * table, Ops_::band (c, mask));
+        }
+
+        template <int MUL_>
+        TIGER_SIMD_TARGET void Round (vec_t (&a)[V_], vec_t (&b)[V_], vec_t (&c)[V_], size_t i) {
+            const vec_t mask = Ops_::set1 (0xFFu);
+            for (size_t v = 0; v < V_; ++v) {
+                auto cc = Ops_::bxor (c[v], x_[i][v]);
+                c[v]    = cc;
+
+                // clang-format off
+                auto even = Ops_::bxor (Ops_::bxor (lookup (0, cc, mask),
+                                                    lookup (1, Ops_::template shr<16> (cc), mask)),
+                                        Ops_::bxor (lookup (2, Ops_::template shr<32> (cc), mask),
+                                                    lookup (3, Ops_::template shr<48> (cc), mask)));
+                auto odd  = Ops_::bxor (Ops_::bxor (lookup (3, Ops_::template shr< 8> (cc), mask),
+                                                    lookup (2, Ops_::template shr<24> (cc), mask)),
+                                        Ops_::bxor (lookup (1, Ops_::template shr<40> (cc), mask),
+                                                    lookup (0, Ops_::template shr<56> (cc), mask)));
+                // clang-format on
+                a[v] = Ops_::sub (a[v], even);
+                b[v] = mul (Ops_::add (b[v], odd), std::integral_constant<int, MUL_> {});
+            }
+        }
+
+        template <int MUL_>
+        TIGER_SIMD_TARGET void Pass (vec_t (&a)[V_], vec_t (&b)[V_], vec_t (&c)[V_]) {
+            Round<MUL_> (a, b, c, 0);
+            Round<MUL_> (b, c, a, 1);
+            Round<MUL_> (c, a, b, 2);
+            Round<MUL_> (a, b, c, 3);
+            Round<MUL_> (b, c, a, 4);
+            Round<MUL_> (c, a, b, 5);
+            Round<MUL_> (a, b, c, 6);
+            Round<MUL_> (b, c, a, 7);
+        }
+
+        TIGER_SIMD_TARGET void Schedule () {
+            const vec_t ones = Ops_::set1 (~static_cast<uint64_t> (0));
+            const vec_t sch0 = Ops_::set1 (schedule_0);
+            const vec_t sch1 = Ops_::set1 (schedule_1);
+            for (size_t v = 0; v < V_; ++v) {
+                auto x0 = x_[0][v];
+                auto x1 = x_[1][v];
+                auto x2 = x_[2][v];
+                auto x3 = x_[3][v];
+                auto x4 = x_[4][v];
+                auto x5 = x_[5][v];
+                auto x6 = x_[6][v];
+                auto x7 = x_[7][v];
+
+                x0 = Ops_::sub (x0, Ops_::bxor (x7, sch0));
+                x1 = Ops_::bxor (x1, x0);
+                x2 = Ops_::add (x2, x1);
+                x3 = Ops_::sub (x3, Ops_::bxor (x2, Ops_::template shl<19> (Ops_::bxor (x1, ones))));
+                x4 = Ops_::bxor (x4, x3);
+                x5 = Ops_::add (x5, x4);
+                x6 = Ops_::sub (x6, Ops_::bxor (x5, Ops_::template shr<23> (Ops_::bxor (x4, ones))));
+                x7 = Ops_::bxor (x7, x6);
+                x0 = Ops_::add (x0, x7);
+                x1 = Ops_::sub (x1, Ops_::bxor (x0, Ops_::template shl<19> (Ops_::bxor (x7, ones))));
+                x2 = Ops_::bxor (x2, x1);
+                x3 = Ops_::add (x3, x2);
+                x4 = Ops_::sub (x4, Ops_::bxor (x3, Ops_::template shr<23> (Ops_::bxor (x2, ones))));
+                x5 = Ops_::bxor (x5, x4);
+                x6 = Ops_::add (x6, x5);
+                x7 = Ops_::sub (x7, Ops_::bxor (x6, sch1));
+
+                x_[0][v] = x0;
+                x_[1][v] = x1;
+                x_[2][v] = x2;
+                x_[3][v] = x3;
+                x_[4][v] = x4;
+                x_[5][v] = x5;
+                x_[6][v] = x6;
+                x_[7][v] = x7;
+            }
+        }
+    };
+
+    /// Kernel entry point for LANES_ lanes.
+    template <typename Ops_, size_t LANES_>
+    TIGER_SIMD_TARGET void compress_simd (state_t *state, const msgblock_t *input, const sbox_t &sbox, size_t passes) {
+        static_assert (LANES_ % Ops_::WIDTH == 0, "# of lanes should be a multiple of the vector width");
+        SimdCompressor<Ops_, LANES_ / Ops_::WIDTH> compressor {sbox};
+        compressor.Compress (state, input, passes);
+    }
+}}}  // namespace Tiger::internal::
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Multi-lane compression kernels.
+#pragma once
+
+#include "Kernel.hpp"
+#include "Tiger.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#    define TIGER_HAVE_X86_KERNELS 1
+#endif
+
+namespace Tiger { namespace internal {
+    /// Compresses the blocks of the lanes in lockstep.
+    using compress_lanes_t = void (*) (state_t *state, const msgblock_t *input, const sbox_t &sbox, size_t passes);
+
+    /** Entry points of a kernel.  */
+    struct KernelTable {
+        Kernel           kernel;
+        compress_lanes_t compress2;
+        compress_lanes_t compress4;
+        compress_lanes_t compress8;
+
+        template <size_t N_>
+        compress_lanes_t Get () const;
+    };
+
+    template <>
+    inline compress_lanes_t KernelTable::Get<2> () const {
+        return compress2;
+    }
+    template <>
+    inline compress_lanes_t KernelTable::Get<4> () const {
+        return compress4;
+    }
+    template <>
+    inline compress_lanes_t KernelTable::Get<8> () const {
+        return compress8;
+    }
+
+    /**
+     * Hashes COUNT messages in N_ interleaved lanes with the active kernel.
+     *
+     * @remarks Each message continues from the chaining state INIT after
+     *          PREFIX bytes (a multiple of 64, 0 for the plain digests).
+     */
+    template <size_t N_>
+    void hash_lanes (digest_t *         result,
+                     const void *const *data,
+                     const size_t *     sizes,
+                     size_t             count,
+                     const sbox_t &     sbox,
+                     size_t             passes,
+                     bool               isTiger2,
+                     const state_t &    init,
+                     uint64_t           prefix) noexcept;
+
+    /// The kernel in use.
+    const KernelTable &active_kernel () noexcept;
+
+    const KernelTable &portable_kernel () noexcept;
+#ifdef TIGER_HAVE_X86_KERNELS
+    const KernelTable &sse42_kernel () noexcept;
+    const KernelTable &avx2_kernel () noexcept;
+    const KernelTable &avx512_kernel () noexcept;
+#endif
+}}  // namespace Tiger::internal
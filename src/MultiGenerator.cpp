@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "MultiGenerator.hpp"
+
+#include "Internal.hpp"
+#include "Kernels.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Tiger {
+    using namespace internal;
+
+    namespace {
+        /** The per-lane cursor over the blocks of a message.  */
+        struct Lane {
+            const uint8_t *src       = nullptr;  ///< Next full block in the message
+            size_t         cntFull   = 0;        ///< # of remaining full blocks
+            size_t         cntFinal  = 0;        ///< # of final (padded) blocks
+            size_t         idxFinal  = 0;        ///< Next final block
+            size_t         idxResult = 0;        ///< Index of the message
+            bool           active    = false;
+            uint8_t        tail[2 * sizeof (msgblock_t)];
+
+            void Start (size_t index, const void *data, size_t size, uint64_t prefix, bool isTiger2) noexcept {
+                auto p    = static_cast<const uint8_t *> (data);
+                src       = p;
+                cntFull   = size / sizeof (msgblock_t);
+                cntFinal  = make_final_blocks (tail, p + sizeof (msgblock_t) * cntFull, size % sizeof (msgblock_t), prefix + size, isTiger2);
+                idxFinal  = 0;
+                idxResult = index;
+                active    = true;
+            }
+
+            /// Loads the next block.  Returns false if this was the last one.
+            bool Next (msgblock_t &block) noexcept {
+                if (0 < cntFull) {
+                    load_block (block, src);
+                    src += sizeof (msgblock_t);
+                    --cntFull;
+                }
+                else {
+                    load_block (block, &tail[sizeof (msgblock_t) * idxFinal]);
+                    ++idxFinal;
+                }
+                return 0 < cntFull || idxFinal < cntFinal;
+            }
+        };
+    }  // namespace
+
+    template <size_t N_>
+    MultiGenerator<N_>::MultiGenerator (const sbox_t &sbox, size_t cntPass, bool isTiger2) noexcept
+            : sbox_ {sbox}
+            , cntPass_ {std::max (DEFAULT_PASSES, cntPass)}
+            , isTiger2_ {isTiger2} {
+        /* NO-OP */
+    }
+
+    namespace internal {
+        template <size_t N_>
+        void hash_lanes (digest_t *         result,
+                         const void *const *data,
+                         const size_t *     sizes,
+                         size_t             count,
+                         const sbox_t &     sbox,
+                         size_t             passes,
+                         bool               isTiger2,
+                         const state_t &    init,
+                         uint64_t           prefix) noexcept {
+            std::array<Lane, N_>       lanes;
+            std::array<state_t, N_>    states {};
+            std::array<msgblock_t, N_> blocks {};
+
+            size_t next      = 0;
+            size_t cntActive = 0;
+
+            auto compress = active_kernel ().Get<N_> ();
+
+            auto start = [&] (size_t k) {
+                if (next < count) {
+                    lanes[k].Start (next, data[next], sizes[next], prefix, isTiger2);
+                    states[k] = init;
+                    ++next;
+                    ++cntActive;
+                }
+                else {
+                    lanes[k].active = false;
+                }
+            };
+            for (size_t k = 0; k < N_; ++k) {
+                start (k);
+            }
+            // Runs all lanes in lockstep while it pays.  Retired lanes keep
+            // compressing their stale block and their results are discarded.
+            while (1 < cntActive) {
+                std::array<bool, N_> last;
+                for (size_t k = 0; k < N_; ++k) {
+                    last[k] = lanes[k].active && ! lanes[k].Next (blocks[k]);
+                }
+                compress (states.data (), blocks.data (), sbox, passes);
+                for (size_t k = 0; k < N_; ++k) {
+                    if (last[k]) {
+                        result[lanes[k].idxResult] = make_digest (states[k]);
+                        --cntActive;
+                        start (k);
+                    }
+                }
+            }
+            // Drains the last lane alone.
+            for (size_t k = 0; k < N_; ++k) {
+                if (lanes[k].active) {
+                    bool more;
+                    do {
+                        more = lanes[k].Next (blocks[k]);
+                        Compress (states[k], blocks[k], sbox, passes);
+                    } while (more);
+                    result[lanes[k].idxResult] = make_digest (states[k]);
+                }
+            }
+        }
+
+        template void hash_lanes<2> (digest_t *, const void *const *, const size_t *, size_t, const sbox_t &, size_t, bool, const state_t &, uint64_t) noexcept;
+        template void hash_lanes<4> (digest_t *, const void *const *, const size_t *, size_t, const sbox_t &, size_t, bool, const state_t &, uint64_t) noexcept;
+        template void hash_lanes<8> (digest_t *, const void *const *, const size_t *, size_t, const sbox_t &, size_t, bool, const state_t &, uint64_t) noexcept;
+    }  // namespace internal
+
+    template <size_t N_>
+    void MultiGenerator<N_>::Hash (digest_t *result, const void *const *data, const size_t *sizes, size_t count) const noexcept {
+        hash_lanes<N_> (result, data, sizes, count, sbox_, cntPass_, isTiger2_, state_t {{init_state_0, init_state_1, init_state_2}}, 0);
+    }
+
+    template class MultiGenerator<2>;
+    template class MultiGenerator<4>;
+    template class MultiGenerator<8>;
+}  // namespace Tiger
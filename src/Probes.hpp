@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Instrumentation hooks of the generators (no-ops unless TIGER_ENABLE_INSTRUMENTATION).
+#pragma once
+
+#include "Instrumentation.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+#    if defined(__x86_64__) || defined(__i386__)
+#        include <x86intrin.h>
+#    else
+#        include <chrono>
+#    endif
+#endif
+
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+extern "C" {
+/**
+ * Fired once per `Update` or `Finalize` compressing any block (when the instrumentation is compiled in).
+ *
+ * An attach point for the sampling tools (`perf probe -x libtiger.so tiger_probe_compress blocks cycles`),
+ * also emitted as the USDT probe `tiger:compress` where <sys/sdt.h> is available.
+ */
+void tiger_probe_compress (uint64_t blocks, uint64_t cycles);
+}
+#endif
+
+namespace Tiger { namespace internal {
+#ifdef TIGER_ENABLE_INSTRUMENTATION
+    /** Counters of a thread (written by the owner alone, read by the registry).  */
+    struct LocalCounters {
+        std::atomic<uint64_t>                                       blocks {0};
+        std::atomic<uint64_t>                                       bytes {0};
+        std::atomic<uint64_t>                                       updates {0};
+        std::atomic<uint64_t>                                       finalizes {0};
+        std::atomic<uint64_t>                                       cycles {0};
+        std::array<std::atomic<uint64_t>, Counters::HISTOGRAM_SIZE> updateSizes {};
+
+        Counters Load () const noexcept;
+        void     Clear () noexcept;
+    };
+
+    /// The counters of the calling thread (registered on the first use).
+    LocalCounters &thread_counters () noexcept;
+
+    extern std::atomic<bool> cycle_timing;
+
+    /// Increments a counter owned by the calling thread (no RMW needed).
+    inline void bump (std::atomic<uint64_t> &counter, uint64_t n) noexcept {
+        counter.store (counter.load (std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    inline size_t histogram_bucket (size_t size) noexcept {
+        size_t result = 0;
+        while (size != 0 && result < Counters::HISTOGRAM_SIZE - 1) {
+            size >>= 1u;
+            ++result;
+        }
+        return result;
+    }
+
+    inline uint64_t read_cycles () noexcept {
+#    if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc ();
+#    else
+        return static_cast<uint64_t> (std::chrono::steady_clock::now ().time_since_epoch ().count ());
+#    endif
+    }
+
+    /**
+     * Counts an `Update` or a `Finalize` call.
+     *
+     * The compressions are counted locally and reported (to the thread's
+     * counters and to `tiger_probe_compress`) once when the call returns.
+     */
+    class CallProbe {
+        LocalCounters &counters_;
+        bool           timing_;
+        uint64_t       blocks_ = 0;
+        uint64_t       cycles_ = 0;
+
+    public:
+        CallProbe () noexcept : counters_ (thread_counters ()), timing_ {cycle_timing.load (std::memory_order_relaxed)} { /* NO-OP */
+        }
+
+        CallProbe (const CallProbe &) = delete;
+        CallProbe &operator= (const CallProbe &) = delete;
+
+        ~CallProbe () {
+            if (0 < blocks_) {
+                bump (counters_.blocks, blocks_);
+                bump (counters_.cycles, cycles_);
+                tiger_probe_compress (blocks_, cycles_);
+            }
+        }
+
+        void Update (size_t size) noexcept {
+            bump (counters_.updates, 1);
+            bump (counters_.bytes, size);
+            bump (counters_.updateSizes[histogram_bucket (size)], 1);
+        }
+
+        void Finalize () noexcept { bump (counters_.finalizes, 1); }
+
+        /// Runs the compression COMPRESS (of a block).
+        template <typename Compress_>
+        void Compress (Compress_ &&compress) noexcept {
+            if (timing_) {
+                auto const start = read_cycles ();
+                compress ();
+                cycles_ += read_cycles () - start;
+            }
+            else {
+                compress ();
+            }
+            ++blocks_;
+        }
+    };
+#else
+    class CallProbe {
+    public:
+        void Update (size_t) noexcept { /* NO-OP */
+        }
+
+        void Finalize () noexcept { /* NO-OP */
+        }
+
+        template <typename Compress_>
+        void Compress (Compress_ &&compress) noexcept {
+            compress ();
+        }
+    };
+#endif
+}}  // namespace Tiger::internal
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "SBoxCache.hpp"
+
+#include "FileIO.hpp"
+#include "Internal.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define TIGER_HAVE_POSIX_IO 1
+#endif
+
+namespace Tiger {
+    using namespace internal;
+
+    namespace {
+        /// Trailer following the table: Magic and the fingerprint (in little-endian).
+        const char   FILE_MAGIC[8] = {'T', 'G', 'R', 'S', 'B', 'O', 'X', '1'};
+        const size_t FILE_SIZE     = sizeof (sbox_t) + sizeof (FILE_MAGIC) + 8;
+
+        /// Serializes the SBOX in the file format.
+        std::vector<uint8_t> encode (const sbox_t &sbox) {
+            std::vector<uint8_t> result (FILE_SIZE);
+            for (size_t i = 0; i < sbox.size (); ++i) {
+                to_bytes (&result[8 * i], sbox[i]);
+            }
+            ::memcpy (&result[sizeof (sbox_t)], FILE_MAGIC, sizeof (FILE_MAGIC));
+            to_bytes (&result[sizeof (sbox_t) + sizeof (FILE_MAGIC)], SBoxFingerprint (sbox));
+            return result;
+        }
+
+        /// Checks the trailer of the (mapped or read) file contents.
+        bool is_valid (const uint8_t *data, const sbox_t &sbox) {
+            return ::memcmp (data + sizeof (sbox_t), FILE_MAGIC, sizeof (FILE_MAGIC)) == 0
+                   && as_uint64 (data + sizeof (sbox_t) + sizeof (FILE_MAGIC)) == SBoxFingerprint (sbox);
+        }
+    }  // namespace
+
+    void BuildSBoxes (sbox_t *result, const ByteView *seeds, size_t count, size_t passes, size_t cntThread) {
+        ThreadPool pool (std::min (cntThread == 0 ? std::max<size_t> (1, std::thread::hardware_concurrency ()) : cntThread,
+                                   std::max<size_t> (1, count)));
+        pool.ParallelFor (count, [result, seeds, passes] (size_t i) { InitializeSBox (result[i], seeds[i].data, seeds[i].size, passes); });
+    }
+
+    /** A cached table: Either mapped from the file or held in memory.  */
+    struct SBoxCache::Entry {
+        void                   *addr = nullptr;
+        std::unique_ptr<sbox_t> owned;
+        const sbox_t           *table = nullptr;
+
+        ~Entry () {
+#ifdef TIGER_HAVE_POSIX_IO
+            if (addr != nullptr) {
+                ::munmap (addr, FILE_SIZE);
+            }
+#endif
+        }
+    };
+
+    SBoxCache::SBoxCache (const std::string &directory) : directory_ {directory} {
+#ifdef TIGER_HAVE_POSIX_IO
+        if (::mkdir (directory_.c_str (), 0777) != 0 && errno != EEXIST) {
+            throw_errno (errno, directory_);
+        }
+#endif
+    }
+
+    SBoxCache::~SBoxCache () = default;
+
+    std::string SBoxCache::PathOf (const void *seed, size_t seed_size, size_t passes) const {
+        // Only the first 64 bytes of the seed (zero padded) take effect.
+        uint8_t work[sizeof (msgblock_t)] = {};
+        ::memcpy (work, seed, std::min (seed_size, sizeof (work)));
+
+        static const char digits[] = "0123456789abcdef";
+        std::string       result   = directory_ + "/";
+        for (auto v : Hash (work, sizeof (work))) {
+            result += digits[v >> 4u];
+            result += digits[v & 0x0Fu];
+        }
+        return result + "-" + std::to_string (passes) + ".sbox";
+    }
+
+    const sbox_t &SBoxCache::Get (const void *seed, size_t seed_size, size_t passes) {
+        auto const path = PathOf (seed, seed_size, passes);
+        if (auto p = Find (path)) {
+            return *p;
+        }
+        sbox_t sbox;
+        InitializeSBox (sbox, seed, seed_size, passes);
+        return Store (path, sbox);
+    }
+
+    void SBoxCache::Get (const sbox_t **result, const ByteView *seeds, size_t count, size_t passes, size_t cntThread) {
+        std::vector<size_t>      missing;
+        std::vector<std::string> paths (count);
+        for (size_t i = 0; i < count; ++i) {
+            paths[i]  = PathOf (seeds[i].data, seeds[i].size, passes);
+            result[i] = Find (paths[i]);
+            if (result[i] == nullptr) {
+                missing.emplace_back (i);
+            }
+        }
+        if (missing.empty ()) {
+            return;
+        }
+        std::vector<ByteView> pending;
+        for (auto i : missing) {
+            pending.emplace_back (seeds[i]);
+        }
+        std::vector<sbox_t> built (missing.size ());
+        BuildSBoxes (built.data (), pending.data (), pending.size (), passes, cntThread);
+        for (size_t k = 0; k < missing.size (); ++k) {
+            result[missing[k]] = &Store (paths[missing[k]], built[k]);
+        }
+    }
+
+    const sbox_t *SBoxCache::Find (const std::string &path) {
+        std::lock_guard<std::mutex> lock (mutex_);
+        auto                        it = entries_.find (path);
+        if (it != entries_.end ()) {
+            return it->second->table;
+        }
+        std::unique_ptr<Entry> entry {new Entry};
+#ifdef TIGER_HAVE_POSIX_IO
+        int fd = ::open (path.c_str (), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            if (errno == ENOENT) {
+                return nullptr;
+            }
+            throw_errno (errno, path);
+        }
+        struct stat st {};
+        void       *addr = MAP_FAILED;
+        if (::fstat (fd, &st) == 0 && static_cast<size_t> (st.st_size) == FILE_SIZE) {
+            addr = ::mmap (nullptr, FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        ::close (fd);
+        if (addr == MAP_FAILED) {
+            return nullptr;  // Rebuilt (and replaced)
+        }
+        entry->addr = addr;
+        auto data   = static_cast<const uint8_t *> (addr);
+        if (TARGET_LITTLE_ENDIAN) {
+            entry->table = static_cast<const sbox_t *> (addr);
+        }
+        else {
+            entry->owned.reset (new sbox_t);
+            for (size_t i = 0; i < entry->owned->size (); ++i) {
+                (*entry->owned)[i] = as_uint64 (data + 8 * i);
+            }
+            entry->table = entry->owned.get ();
+        }
+        if (! is_valid (data, *entry->table)) {
+            return nullptr;
+        }
+#else
+        std::unique_ptr<std::FILE, int (*) (std::FILE *)> fp {std::fopen (path.c_str (), "rb"), &std::fclose};
+        if (! fp) {
+            return nullptr;
+        }
+        std::vector<uint8_t> data (FILE_SIZE + 1);
+        if (std::fread (data.data (), 1, data.size (), fp.get ()) != FILE_SIZE) {
+            return nullptr;
+        }
+        entry->owned.reset (new sbox_t);
+        for (size_t i = 0; i < entry->owned->size (); ++i) {
+            (*entry->owned)[i] = as_uint64 (&data[8 * i]);
+        }
+        entry->table = entry->owned.get ();
+        if (! is_valid (data.data (), *entry->table)) {
+            return nullptr;
+        }
+#endif
+        auto result = entry->table;
+        entries_.emplace (path, std::move (entry));
+        return result;
+    }
+
+    const sbox_t &SBoxCache::Store (const std::string &path, const sbox_t &sbox) {
+        auto const data = encode (sbox);
+        replace_file (path, {ByteView {data.data (), data.size ()}});
+        if (auto p = Find (path)) {
+            return *p;
+        }
+        // Not readable back: Keeps the table in memory.
+        std::unique_ptr<Entry> entry {new Entry};
+        entry->owned.reset (new sbox_t (sbox));
+        entry->table = entry->owned.get ();
+
+        std::lock_guard<std::mutex> lock (mutex_);
+        return *entries_.emplace (path, std::move (entry)).first->second->table;
+    }
+}  // namespace Tiger
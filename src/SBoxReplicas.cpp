@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "SBoxReplicas.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    define TIGER_HAVE_NUMA_NODES 1
+#endif
+
+namespace Tiger {
+    namespace {
+        /// Size of the mapping holding a replica (whole pages).
+        size_t replica_size () noexcept {
+#if defined(TIGER_HAVE_NUMA_NODES)
+            auto page = static_cast<size_t> (::sysconf (_SC_PAGESIZE));
+            return (sizeof (sbox_t) + page - 1) / page * page;
+#else
+            return sizeof (sbox_t);
+#endif
+        }
+
+        /// Counts the NUMA nodes (from the "0-N" list in the sysfs).
+        size_t count_nodes () noexcept {
+            size_t result = 1;
+#if defined(TIGER_HAVE_NUMA_NODES)
+            if (auto f = ::fopen ("/sys/devices/system/node/possible", "r")) {
+                unsigned int lo = 0;
+                unsigned int hi = 0;
+                int          n  = ::fscanf (f, "%u-%u", &lo, &hi);
+                if (n == 2 && lo <= hi) {
+                    result = hi + 1;
+                }
+                ::fclose (f);
+            }
+#endif
+            return std::min<size_t> (std::max<size_t> (1, result), SBoxReplicas::MAX_NODES);
+        }
+
+        /// The node the calling thread runs on.
+        size_t current_node () noexcept {
+#if defined(TIGER_HAVE_NUMA_NODES) && defined(SYS_getcpu)
+            unsigned int cpu  = 0;
+            unsigned int node = 0;
+            if (::syscall (SYS_getcpu, &cpu, &node, nullptr) == 0) {
+                return node;
+            }
+#endif
+            return 0;
+        }
+
+        /**
+         * Allocates the pages of a replica for the NODE.
+         *
+         * The pages are bound to the NODE (preferred, as the node may run out
+         * of memory) before they are touched, so the replica lands there
+         * whichever thread writes it.  Without the `mbind` (no NUMA support in
+         * the kernel), the pages go to the node of the first writer.
+         */
+        sbox_t *allocate_replica (size_t node) noexcept {
+#if defined(TIGER_HAVE_NUMA_NODES)
+            void *p = ::mmap (nullptr, replica_size (), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) {
+                return nullptr;
+            }
+#    if defined(SYS_mbind)
+            const int     PREFERRED = 1;  // MPOL_PREFERRED (<numaif.h> comes with libnuma)
+            const size_t  BITS      = 8 * sizeof (unsigned long);
+            unsigned long mask[(SBoxReplicas::MAX_NODES + BITS - 1) / BITS] = {};
+            mask[node / BITS] |= 1ul << (node % BITS);
+            ::syscall (SYS_mbind, p, replica_size (), PREFERRED, mask, SBoxReplicas::MAX_NODES + 1, 0u);
+#    endif
+            return static_cast<sbox_t *> (p);
+#else
+            return new (std::nothrow) sbox_t;
+#endif
+        }
+
+        void release_replica (sbox_t *replica) noexcept {
+#if defined(TIGER_HAVE_NUMA_NODES)
+            ::munmap (replica, replica_size ());
+#else
+            delete replica;
+#endif
+        }
+    }  // namespace
+
+    const size_t SBoxReplicas::MAX_NODES;
+
+    SBoxReplicas::SBoxReplicas (const sbox_t &sbox)
+            : source_ {sbox}
+            , cntNode_ {count_nodes ()}
+            , replicas_ {new std::atomic<sbox_t *>[cntNode_]} {
+        for (size_t i = 0; i < cntNode_; ++i) {
+            replicas_[i].store (nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    SBoxReplicas::~SBoxReplicas () {
+        for (size_t i = 0; i < cntNode_; ++i) {
+            if (auto p = replicas_[i].load (std::memory_order_relaxed)) {
+                release_replica (p);
+            }
+        }
+    }
+
+    const sbox_t &SBoxReplicas::Local () noexcept {
+        return Replica (current_node ());
+    }
+
+    const sbox_t &SBoxReplicas::Replica (size_t node) noexcept {
+        if (cntNode_ <= node) {
+            node = 0;
+        }
+        if (auto p = replicas_[node].load (std::memory_order_acquire)) {
+            return *p;
+        }
+        std::lock_guard<std::mutex> lock (mutex_);
+        auto                        p = replicas_[node].load (std::memory_order_relaxed);
+        if (p == nullptr) {
+            p = allocate_replica (node);
+            if (p == nullptr) {
+                return source_;
+            }
+            ::memcpy (p, &source_, sizeof (source_));
+            replicas_[node].store (p, std::memory_order_release);
+        }
+        return *p;
+    }
+}  // namespace Tiger
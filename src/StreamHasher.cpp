@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "StreamHasher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <system_error>
+
+namespace Tiger {
+    namespace {
+        using clock_t = std::chrono::steady_clock;
+
+        double elapsed (clock_t::time_point start) {
+            return std::chrono::duration<double> (clock_t::now () - start).count ();
+        }
+    }  // namespace
+
+    StreamHasher::StreamHasher (const StreamHasherOptions &options)
+            : buffers_ (std::max<size_t> (2, options.cntBuffer), std::vector<uint8_t> (std::max<size_t> (1, options.bufferSize)))
+            , sizes_ (buffers_.size ())
+            , gen_ {options.sbox != nullptr ? *options.sbox : DefaultSBox (), options.passes, options.padding == Padding::Tiger2}
+            , result_ {promise_.get_future ().share ()} {
+        thread_ = std::thread ([this] () { Run (); });
+    }
+
+    StreamHasher::~StreamHasher () {
+        Finalize ();
+        thread_.join ();
+    }
+
+    StreamHasher &StreamHasher::Write (const void *data, size_t size) {
+        if (finalized_) {
+            return *this;
+        }
+        auto const *p = static_cast<const uint8_t *> (data);
+        while (0 < size) {
+            Acquire ();
+            size_t n = std::min (size, buffers_[tail_].size () - used_);
+            std::memcpy (current_ + used_, p, n);
+            used_ += n;
+            count_ += n;
+            p += n;
+            size -= n;
+            if (used_ == buffers_[tail_].size ()) {
+                Submit ();
+            }
+        }
+        return *this;
+    }
+
+    int StreamHasher::Pump (const read_t &read) {
+        if (finalized_) {
+            return 0;
+        }
+        for (;;) {
+            Acquire ();
+            auto n = read (current_ + used_, buffers_[tail_].size () - used_);
+            if (n < 0) {
+                return static_cast<int> (-n);
+            }
+            if (n == 0) {
+                return 0;
+            }
+            used_ += static_cast<size_t> (n);
+            count_ += static_cast<uint64_t> (n);
+            if (used_ == buffers_[tail_].size ()) {
+                Submit ();
+            }
+        }
+    }
+
+    std::shared_future<StreamHasherResult> StreamHasher::Finalize () {
+        if (! finalized_) {
+            if (0 < used_) {
+                Submit ();
+            }
+            {
+                std::lock_guard<std::mutex> lock (mutex_);
+                closed_ = true;
+            }
+            cond_.notify_all ();
+            finalized_ = true;
+        }
+        return result_;
+    }
+
+    void StreamHasher::Acquire () {
+        if (current_ != nullptr) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock (mutex_);
+        if (buffers_.size () <= filled_) {
+            auto const start = clock_t::now ();
+            cond_.wait (lock, [this] () { return filled_ < buffers_.size (); });
+            producerStall_ += elapsed (start);
+        }
+        current_ = buffers_[tail_].data ();
+        used_    = 0;
+    }
+
+    void StreamHasher::Submit () {
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            sizes_[tail_] = used_;
+            ++filled_;
+        }
+        cond_.notify_all ();
+        tail_    = (tail_ + 1) % buffers_.size ();
+        current_ = nullptr;
+        used_    = 0;
+    }
+
+    void StreamHasher::Run () {
+        auto const start = clock_t::now ();
+
+        StreamHasherResult result;
+        for (;;) {
+            size_t idx;
+            {
+                std::unique_lock<std::mutex> lock (mutex_);
+                if (filled_ == 0 && ! closed_) {
+                    auto const t = clock_t::now ();
+                    cond_.wait (lock, [this] () { return 0 < filled_ || closed_; });
+                    result.hasherStall += elapsed (t);
+                }
+                if (filled_ == 0) {
+                    result.producerStall = producerStall_;
+                    break;
+                }
+                idx = head_;
+            }
+            gen_.Update (buffers_[idx].data (), sizes_[idx]);
+            result.size += sizes_[idx];
+            {
+                std::lock_guard<std::mutex> lock (mutex_);
+                head_ = (head_ + 1) % buffers_.size ();
+                --filled_;
+            }
+            cond_.notify_all ();
+        }
+        result.digest  = gen_.Finalize ();
+        result.seconds = elapsed (start);
+        promise_.set_value (result);
+    }
+
+    std::future<StreamHasherResult> HashStream (StreamHasher::read_t read, const StreamHasherOptions &options) {
+        return std::async (std::launch::async, [read, options] () {
+            StreamHasher hasher (options);
+            if (auto err = hasher.Pump (read)) {
+                throw std::system_error (err, std::generic_category ());
+            }
+            return hasher.Finalize ().get ();
+        });
+    }
+}  // namespace Tiger
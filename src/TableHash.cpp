@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "TableHash.hpp"
+
+#include "Internal.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+
+namespace Tiger {
+    using namespace internal;
+
+    namespace {
+        const size_t BLOCK_SIZE = sizeof (msgblock_t);
+
+        state_t random_key () noexcept {
+            state_t result {{init_state_0, init_state_1, init_state_2}};
+            try {
+                std::random_device rd;
+                for (auto &k : result) {
+                    k = (static_cast<uint64_t> (rd ()) << 32u) ^ rd ();
+                }
+            }
+            catch (...) {
+                // No entropy source: Falls back to the clock and the address space layout.
+                auto const t = static_cast<uint64_t> (std::chrono::high_resolution_clock::now ().time_since_epoch ().count ());
+                result[0] ^= t;
+                result[1] ^= reinterpret_cast<uintptr_t> (&result);
+                result[2] ^= reinterpret_cast<uintptr_t> (&random_key);
+            }
+            return result;
+        }
+    }  // namespace
+
+    const size_t TableHash::PASSES;
+
+    uint64_t TableHash::operator() (const void *data, size_t size) const noexcept {
+        // The length goes into the chaining state, so the zero-filled tail is unambiguous.
+        state_t state {{key_[0], key_[1], key_[2] + size}};
+
+        msgblock_t  block;
+        auto const *p = static_cast<const uint8_t *> (data);
+        for (; BLOCK_SIZE < size; p += BLOCK_SIZE, size -= BLOCK_SIZE) {
+            load_block (block, p);
+            CompressPasses<PASSES> (state, block, *sbox_);
+        }
+        uint8_t tail[BLOCK_SIZE] = {};
+        if (0 < size) {
+            ::memcpy (tail, p, size);
+        }
+        load_block (block, tail);
+        CompressPasses<PASSES> (state, block, *sbox_);
+        return state[0];
+    }
+
+    uint64_t TableHash::operator() (uint64_t value) const noexcept {
+        state_t    state {{key_[0], key_[1], key_[2] + sizeof (value)}};
+        msgblock_t block {{value, 0, 0, 0, 0, 0, 0, 0}};
+        CompressPasses<PASSES> (state, block, *sbox_);
+        return state[0];
+    }
+
+    const state_t &TableHash::ProcessKey () noexcept {
+        static const state_t key = random_key ();
+        return key;
+    }
+}  // namespace Tiger
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace Tiger { namespace internal {
+    ThreadPool::ThreadPool (size_t cntThread) {
+        if (cntThread == 0) {
+            cntThread = std::max<size_t> (1, std::thread::hardware_concurrency ());
+        }
+        workers_.reserve (cntThread - 1);
+        for (size_t i = 1; i < cntThread; ++i) {
+            workers_.emplace_back ([this] () { Run (); });
+        }
+    }
+
+    ThreadPool::~ThreadPool () {
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            quit_ = true;
+        }
+        wakeup_.notify_all ();
+        for (auto &t : workers_) {
+            t.join ();
+        }
+    }
+
+    void ThreadPool::ParallelFor (size_t count, const std::function<void (size_t)> &body) {
+        if (count == 0) {
+            return;
+        }
+        if (workers_.empty () || count == 1) {
+            for (size_t i = 0; i < count; ++i) {
+                body (i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> serialize (serialize_);
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            count_   = count;
+            body_    = &body;
+            cntBusy_ = workers_.size ();
+            next_.store (0, std::memory_order_relaxed);
+            ++generation_;
+        }
+        wakeup_.notify_all ();
+        Drain ();
+
+        std::unique_lock<std::mutex> lock (mutex_);
+        done_.wait (lock, [this] () { return cntBusy_ == 0; });
+        body_ = nullptr;
+    }
+
+    void ThreadPool::Run () {
+        size_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock (mutex_);
+                wakeup_.wait (lock, [this, seen] () { return quit_ || generation_ != seen; });
+                if (quit_) {
+                    return;
+                }
+                seen = generation_;
+            }
+            Drain ();
+            {
+                std::lock_guard<std::mutex> lock (mutex_);
+                --cntBusy_;
+            }
+            done_.notify_one ();
+        }
+    }
+
+    void ThreadPool::Drain () {
+        for (;;) {
+            auto i = next_.fetch_add (1, std::memory_order_relaxed);
+            if (count_ <= i) {
+                return;
+            }
+            (*body_) (i);
+        }
+    }
+}}  // namespace Tiger::internal
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Thread pool for the data-parallel hashing.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tiger { namespace internal {
+    /**
+     * A fixed size thread pool running one data-parallel loop at a time.
+     *
+     * The iterations are claimed one by one from a shared counter, so
+     * the idle threads keep taking the remaining work from the busy ones.
+     */
+    class ThreadPool {
+    private:
+        std::vector<std::thread>           workers_;
+        std::mutex                         mutex_;
+        std::condition_variable            wakeup_;
+        std::condition_variable            done_;
+        std::mutex                         serialize_;
+        size_t                             generation_ = 0;
+        size_t                             cntBusy_    = 0;
+        bool                               quit_       = false;
+        size_t                             count_      = 0;
+        std::atomic<size_t>                next_ {0};
+        const std::function<void (size_t)> *body_ = nullptr;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param cntThread # of threads (including the caller's).  0 uses all hardware threads.
+         */
+        explicit ThreadPool (size_t cntThread);
+
+        ThreadPool (const ThreadPool &) = delete;
+        ThreadPool &operator= (const ThreadPool &) = delete;
+
+        ~ThreadPool ();
+
+        /** # of threads (including the caller's).  */
+        size_t Size () const { return workers_.size () + 1; }
+
+        /**
+         * Runs BODY (i) for i in [0, COUNT).  The calling thread joins the work.
+         *
+         * @param count # of iterations
+         * @param body  The loop body
+         */
+        void ParallelFor (size_t count, const std::function<void (size_t)> &body);
+
+    private:
+        void Run ();
+        void Drain ();
+    };
+}}  // namespace Tiger::internal
@@ -4,183 +4,17 @@
 
 #include "Tiger.hpp"
 
+#include "Internal.hpp"
+#include "Probes.hpp"
+
 #include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstring>
-
-//#define FORCE_RUNTIME_BYTEORDER_CHECKING
-
-namespace {
-
-    const uint64_t init_state_0 = 0x0123456789ABCDEFuLL;
-    const uint64_t init_state_1 = 0xFEDCBA9876543210uLL;
-    const uint64_t init_state_2 = 0xF096A5B4C3B2E187uLL;
-    const uint64_t schedule_0   = 0xA5A5A5A5A5A5A5A5uLL;
-    const uint64_t schedule_1   = 0x0123456789ABCDEFuLL;
-
-#ifndef FORCE_RUNTIME_BYTEORDER_CHECKING
-#    if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && defined(__ORDER_BIG_ENDIAN__)
-#        if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-    const bool TARGET_LITTLE_ENDIAN = true;
-#        elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
-    const bool TARGET_LITTLE_ENDIAN = false;
-#        else
-#            define FORCE_RUNTIME_BYTEORDER_CHECKING 1
-#        endif
-#    endif
-#endif /* FORCE_RUNTIME_BYTEORDER_CHECKING */
-
-#ifdef FORCE_RUNTIME_BYTEORDER_CHECKING
-    bool check_little_endian () noexcept {
-        unsigned int val = 0x01020304;
-
-        auto p = reinterpret_cast<const uint8_t *> (&val);
-
-        if (p[0] == 0x04 && p[1] == 0x03 && p[2] == 0x02 && p[3] == 0x01) {
-            return true;
-        }
-        else if (p[3] == 0x04 && p[2] == 0x03 && p[1] == 0x02 && p[0] == 0x01) {
-            return false;
-        }
-        assert (false);
-        return false;
-    }
-    const bool TARGET_LITTLE_ENDIAN = check_little_endian ();
-#endif /* FORCE_RUNTIME_BYTEORDER_CHECKING */
-
-    inline uint64_t as_uint64 (const void *addr) {
-        auto const *p = static_cast<const uint8_t *> (addr);
-        // clang-format off
-        return ( (static_cast<uint64_t> (p[0]) <<  0u)
-               | (static_cast<uint64_t> (p[1]) <<  8u)
-               | (static_cast<uint64_t> (p[2]) << 16u)
-               | (static_cast<uint64_t> (p[3]) << 24u)
-               | (static_cast<uint64_t> (p[4]) << 32u)
-               | (static_cast<uint64_t> (p[5]) << 40u)
-               | (static_cast<uint64_t> (p[6]) << 48u)
-               | (static_cast<uint64_t> (p[7]) << 56u)
-               );
-        // clang-format on
-    }
-
-    std::array<uint64_t, 8> make_work (const void *seed, size_t size) {
-        std::array<uint8_t, 64> tmp;
-
-        tmp.fill (0);
-        ::memcpy (tmp.data (), seed, std::min (size, tmp.size ()));
-        // clang-format off
-        return std::array<uint64_t, 8> {{ as_uint64 (&tmp[8 * 0])
-                                        , as_uint64 (&tmp[8 * 1])
-                                        , as_uint64 (&tmp[8 * 2])
-                                        , as_uint64 (&tmp[8 * 3])
-                                        , as_uint64 (&tmp[8 * 4])
-                                        , as_uint64 (&tmp[8 * 5])
-                                        , as_uint64 (&tmp[8 * 6])
-                                        , as_uint64 (&tmp[8 * 7])
-                                        }};
-        // clang-format on
-    }
-
-    void to_bytes (uint8_t *result, uint64_t value) {
-        if (TARGET_LITTLE_ENDIAN) {
-            memcpy (result, &value, sizeof (value));
-        }
-        else {
-            auto p = reinterpret_cast<const uint8_t *> (&value);
-            for (size_t i = 0; i < sizeof (value); ++i) {
-                result[i ^ 0x07u] = p[i];
-            }
-        }
-    }
-
-    inline void round (const Tiger::sbox_t &sbox, uint64_t &a, uint64_t &b, uint64_t &c, uint64_t x, uint64_t mul) {
-        c ^= x;
-        // clang-format off
-        auto const c0 = static_cast<uint8_t> (c >>  0u);
-        auto const c1 = static_cast<uint8_t> (c >>  8u);
-        auto const c2 = static_cast<uint8_t> (c >> 16u);
-        auto const c3 = static_cast<uint8_t> (c >> 24u);
-        auto const c4 = static_cast<uint8_t> (c >> 32u);
-        auto const c5 = static_cast<uint8_t> (c >> 40u);
-        auto const c6 = static_cast<uint8_t> (c >> 48u);
-        auto const c7 = static_cast<uint8_t> (c >> 56u);
-        // clang-format on
-
-        a -= (sbox[0 * 256 + c0] ^ sbox[1 * 256 + c2] ^ sbox[2 * 256 + c4] ^ sbox[3 * 256 + c6]);
-        b += (sbox[3 * 256 + c1] ^ sbox[2 * 256 + c3] ^ sbox[1 * 256 + c5] ^ sbox[0 * 256 + c7]);
-        b *= mul;
-    }
-
-}  // namespace
+#include <type_traits>
 
 namespace Tiger {
-
-    namespace {
-        void Compress (state_t &state, const msgblock_t &input, const sbox_t &sbox, size_t passes) noexcept {
-            uint_fast64_t a = state[0];
-            uint_fast64_t b = state[1];
-            uint_fast64_t c = state[2];
-
-            uint_fast64_t x0 = input[0];
-            uint_fast64_t x1 = input[1];
-            uint_fast64_t x2 = input[2];
-            uint_fast64_t x3 = input[3];
-            uint_fast64_t x4 = input[4];
-            uint_fast64_t x5 = input[5];
-            uint_fast64_t x6 = input[6];
-            uint_fast64_t x7 = input[7];
-
-            auto schedule = [&x0, &x1, &x2, &x3, &x4, &x5, &x6, &x7] () {
-                x0 -= x7 ^ schedule_0;
-                x1 ^= x0;
-                x2 += x1;
-                x3 -= x2 ^ ((~x1) << 19u);
-                x4 ^= x3;
-                x5 += x4;
-                x6 -= x5 ^ ((~x4) >> 23u);
-                x7 ^= x6;
-                x0 += x7;
-                x1 -= x0 ^ ((~x7) << 19u);
-                x2 ^= x1;
-                x3 += x2;
-                x4 -= x3 ^ ((~x2) >> 23u);
-                x5 ^= x4;
-                x6 += x5;
-                x7 -= x6 ^ schedule_1;
-            };
-
-            auto pass = [&] (const sbox_t &S, uint64_t &A, uint64_t &B, uint64_t &C, uint64_t MUL) {
-                round (S, A, B, C, x0, MUL);
-                round (S, B, C, A, x1, MUL);
-                round (S, C, A, B, x2, MUL);
-                round (S, A, B, C, x3, MUL);
-                round (S, B, C, A, x4, MUL);
-                round (S, C, A, B, x5, MUL);
-                round (S, A, B, C, x6, MUL);
-                round (S, B, C, A, x7, MUL);
-            };
-
-            pass (sbox, a, b, c, 5);
-            schedule ();
-            pass (sbox, c, a, b, 7);
-            schedule ();
-            pass (sbox, b, c, a, 9);
-
-            for (size_t cnt = 3; cnt < passes; ++cnt) {
-                schedule ();
-                pass (sbox, a, b, c, 9);
-
-                auto tmp = a;
-                a        = c;
-                c        = b;
-                b        = tmp;
-            }
-            state[0] = a ^ state[0];
-            state[1] = b - state[1];
-            state[2] = c + state[2];
-        }
-    }  // namespace
+    using namespace internal;
 
     sbox_t &InitializeSBox (sbox_t &sbox) noexcept {
         return InitializeSBox (sbox,
@@ -211,9 +45,14 @@ namespace Tiger {
 
         auto work = make_work (seed, seed_size);
 
+        // Swaps the COL-th (little-endian) bytes of the entries: Independent of the host byte order.
+        auto swap_byte = [&sbox] (size_t x, size_t y, uint64_t mask) {
+            auto const diff = (sbox[x] ^ sbox[y]) & mask;
+            sbox[x] ^= diff;
+            sbox[y] ^= diff;
+        };
+
         int_fast32_t abc = 2;
-        auto         tp  = reinterpret_cast<uint8_t *> (&sbox[0]);
-        auto         sp  = reinterpret_cast<uint8_t *> (&state[0]);
         for (size_t cnt = 0; cnt < passes; ++cnt) {
             for (int_fast32_t i = 0; i < 256; ++i) {
                 for (int_fast32_t sb = 0; sb < 1024; sb += 256) {
@@ -222,8 +61,9 @@ namespace Tiger {
                         abc = 0;
                         Compress (state, work, sbox, 3);
                     }
-                    for (int_fast32_t col = 0; col < 8; ++col) {
-                        std::swap (tp[8 * (sb + i) + col], tp[8 * (sb + sp[8 * abc + col]) + col]);
+                    for (uint32_t col = 0; col < 8; ++col) {
+                        auto const idx = static_cast<uint8_t> (state[abc] >> (8u * col));
+                        swap_byte (sb + i, sb + idx, 0xFFuLL << (8u * col));
                     }
                 }
             }
@@ -231,9 +71,61 @@ namespace Tiger {
         return sbox;
     }
 
+    uint64_t SBoxFingerprint (const sbox_t &sbox) noexcept {
+        // FNV-1a over the little-endian image of the SBox.
+        uint64_t result = 0xCBF29CE484222325uLL;
+        for (auto v : sbox) {
+            for (size_t i = 0; i < 8; ++i) {
+                result ^= static_cast<uint8_t> (v >> (8 * i));
+                result *= 0x00000100000001B3uLL;
+            }
+        }
+        return result;
+    }
+
+    namespace {
+        using compress_t = void (*) (state_t &state, const msgblock_t &input, const sbox_t &sbox, size_t passes);
+
+        template <size_t PASSES_>
+        void compress_passes (state_t &state, const msgblock_t &input, const sbox_t &sbox, size_t /*passes*/) noexcept {
+            CompressPasses<PASSES_> (state, input, sbox);
+        }
+
+        /// Picks the unrolled compression function for the common pass counts.
+        compress_t select_compress (size_t passes) noexcept {
+            switch (passes) {
+            case 3: return &compress_passes<3>;
+            case 4: return &compress_passes<4>;
+            case 6: return &compress_passes<6>;
+            case 8: return &compress_passes<8>;
+            default: return &Compress;
+            }
+        }
+    }  // namespace
+
+    namespace {
+        /// Hashes the whole message without buffering: full blocks are read in place, the final ones are built on the stack.
+        digest_t hash_oneshot (const sbox_t &sbox, const void *data, size_t size, bool isTiger2) noexcept {
+            state_t state {{init_state_0, init_state_1, init_state_2}};
+            compress_message (data, size, 0, isTiger2, [&state, &sbox] (const msgblock_t &block) {
+                CompressPasses<DEFAULT_PASSES> (state, block, sbox);
+            });
+            return make_digest (state);
+        }
+    }  // namespace
+
+    digest_t Hash (const sbox_t &sbox, const void *data, size_t size) noexcept {
+        return hash_oneshot (sbox, data, size, false);
+    }
+
+    digest_t Hash2 (const sbox_t &sbox, const void *data, size_t size) noexcept {
+        return hash_oneshot (sbox, data, size, true);
+    }
+
     Generator::Generator (const sbox_t &sbox, size_t passes, bool isTiger2) noexcept
             : sbox_ {sbox}
             , cntPass_ {std::max (DEFAULT_PASSES, passes)}
+            , compress_ {select_compress (cntPass_)}
             , hash_ {{init_state_0, init_state_1, init_state_2}} {
         if (isTiger2) {
             flags_ |= 1u << BIT_TIGER2;
@@ -250,84 +142,241 @@ namespace Tiger {
     }
 
     Generator &Generator::Update (const void *data, size_t size) noexcept {
-        auto p = static_cast<const uint8_t *> (data);
-        auto q = reinterpret_cast<uint8_t *> (&buffer_[0]);
-
-        if (TARGET_LITTLE_ENDIAN) {
-            for (size_t i = 0; i < size; ++i) {
-                size_t idx = count_ & 0x3Fu;
-                if (0 < count_ && idx == 0) {
-                    Compress (hash_, buffer_, sbox_, cntPass_);
-                }
-                q[idx] = p[i];
-                ++count_;
-            }
-        }
-        else {
-            for (size_t i = 0; i < size; ++i) {
-                size_t idx = count_ & 0x3Fu;
-                if (0 < count_ && idx == 0) {
-                    Compress (hash_, buffer_, sbox_, cntPass_);
-                }
-                q[0x3F - idx] = p[i];
-                ++count_;
-            }
-        }
+        CallProbe probe;
+        probe.Update (size);
+        update_buffered (buffer_, count_, data, size, [this, &probe] (const msgblock_t &block) {
+            probe.Compress ([&] () { compress_ (hash_, block, sbox_, cntPass_); });
+        });
         return *this;
     }
 
     Generator &Generator::Update (uint8_t value) noexcept {
-        size_t idx = count_ & 0x3Fu;
+        CallProbe probe;
+        probe.Update (1);
+        update_buffered (buffer_, count_, value, [this, &probe] (const msgblock_t &block) {
+            probe.Compress ([&] () { compress_ (hash_, block, sbox_, cntPass_); });
+        });
+        return *this;
+    }
 
-        if (0 < count_ && idx == 0) {
-            Compress (hash_, buffer_, sbox_, cntPass_);
+    Generator &Generator::UpdateV (const ByteView *segments, size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            Update (segments[i].data, segments[i].size);
         }
+        return *this;
+    }
 
-        auto q = reinterpret_cast<uint8_t *> (&buffer_[0]);
-        if (TARGET_LITTLE_ENDIAN) {
-            q[idx] = value;
+    digest_t Generator::Finalize () noexcept {
+        if (! IsFinalized ()) {
+            CallProbe probe;
+            probe.Finalize ();
+            finalize_buffered (buffer_, count_, IsTiger2 (), [this, &probe] (const msgblock_t &block) {
+                probe.Compress ([&] () { compress_ (hash_, block, sbox_, cntPass_); });
+            });
+            flags_ |= (1u << BIT_FINALIZED);
         }
-        else {
-            q[0x3F - idx] = value;
+        return make_digest (hash_);
+    }
+
+    digest_t Generator::Peek () const noexcept {
+        if (IsFinalized ()) {
+            return make_digest (hash_);
         }
-        ++count_;
+        state_t state = hash_;
+        finalize_buffered (buffer_, count_, IsTiger2 (), [this, &state] (const msgblock_t &block) { compress_ (state, block, sbox_, cntPass_); });
+        return make_digest (state);
+    }
+
+    namespace {
+        const uint16_t CONTEXT_FINALIZED = 1u << 0u;
+        const uint16_t CONTEXT_TIGER2    = 1u << 1u;
+
+        static_assert (std::is_trivially_copyable<Context>::value, "Context should be trivially copyable");
+        static_assert (sizeof (Context) <= 104, "Context should be compact");
+    }  // namespace
+
+    Context &Context::Reset (size_t cntPass, Padding padding) noexcept {
+        hash     = state_t {{init_state_0, init_state_1, init_state_2}};
+        buffer   = msgblock_t {};
+        count    = 0;
+        passes   = static_cast<uint16_t> (std::min<size_t> (std::max (DEFAULT_PASSES, cntPass), 0xFFFFu));
+        flags    = padding == Padding::Tiger2 ? CONTEXT_TIGER2 : uint16_t {0};
+        reserved = 0;
         return *this;
     }
 
-    digest_t Generator::Finalize () noexcept {
+    Context &Context::Update (const sbox_t &sbox, const void *data, size_t size) noexcept {
+        CallProbe probe;
+        probe.Update (size);
+        auto   compress = select_compress (passes);
+        size_t n        = static_cast<size_t> (count);
+        update_buffered (buffer, n, data, size, [this, compress, &sbox, &probe] (const msgblock_t &block) {
+            probe.Compress ([&] () { compress (hash, block, sbox, passes); });
+        });
+        count = n;
+        return *this;
+    }
+
+    digest_t Context::Finalize (const sbox_t &sbox) noexcept {
         if (! IsFinalized ()) {
-            uint8_t pad[64];
+            CallProbe probe;
+            probe.Finalize ();
+            auto compress = select_compress (passes);
+            finalize_buffered (buffer, static_cast<size_t> (count), IsTiger2 (), [this, compress, &sbox, &probe] (const msgblock_t &block) {
+                probe.Compress ([&] () { compress (hash, block, sbox, passes); });
+            });
+            flags |= CONTEXT_FINALIZED;
+        }
+        return make_digest (hash);
+    }
 
-            ::memset (pad, 0, sizeof (pad));
+    digest_t Context::Peek (const sbox_t &sbox) const noexcept {
+        if (IsFinalized ()) {
+            return make_digest (hash);
+        }
+        auto    compress = select_compress (passes);
+        state_t state    = hash;
+        finalize_buffered (buffer, static_cast<size_t> (count), IsTiger2 (), [&state, compress, &sbox, this] (const msgblock_t &block) {
+            compress (state, block, sbox, passes);
+        });
+        return make_digest (state);
+    }
 
-            uint64_t bitcount = 8 * static_cast<uint64_t> (count_);
+    namespace {
+        // Layout of the saved state (multi-byte values are in little-endian):
+        //
+        //   [  0,   4) Magic ("TGRS")
+        //   [  4,   5) Format version
+        //   [  5,   6) Flags (Generator::Flags)
+        //   [  6,   8) # of passes
+        //   [  8,  16) SBox fingerprint
+        //   [ 16,  24) # of bytes fed
+        //   [ 24,  48) Intermediate hash
+        //   [ 48, 112) Pending bytes (count % 64 bytes are valid, rest are zero)
+        const uint8_t saved_state_magic[4]   = {'T', 'G', 'R', 'S'};
+        const uint8_t saved_state_version    = 1;
+        const size_t  saved_state_max_passes = 0xFFFFu;
+
+        static_assert (48 + sizeof (msgblock_t) == SAVED_STATE_SIZE, "Saved state layout mismatch");
+    }  // namespace
 
-            if (IsTiger2 ()) {
-                Update (0x80);
-            }
-            else {
-                Update (0x01);
-            }
-            size_t remain = 0x40 - (count_ & 0x3Fu);
-            if (8 <= remain) {
-                Update (pad, remain - 8);
-            }
-            else {
-                // No rooms to store the bit-length.  Requires extra block.
-                Update (pad, remain);
-                Update (pad, sizeof (pad) - 8);
-            }
-            uint8_t tmp[8];
-            to_bytes (tmp, bitcount);
-            Update (tmp, sizeof (tmp));
-            assert ((count_ & 0x3Fu) == 0);
-            Compress (hash_, buffer_, sbox_, cntPass_);
-            flags_ |= (1u << BIT_FINALIZED);
+    savedstate_t Generator::SaveState () const noexcept {
+        savedstate_t result {};
+        auto         p = result.data ();
+        ::memcpy (p, saved_state_magic, sizeof (saved_state_magic));
+        p[4] = saved_state_version;
+        p[5] = static_cast<uint8_t> (flags_);
+        p[6] = static_cast<uint8_t> (cntPass_ >> 0u);
+        p[7] = static_cast<uint8_t> (cntPass_ >> 8u);
+        to_bytes (p + 8, SBoxFingerprint (sbox_));
+        to_bytes (p + 16, count_);
+        to_bytes (p + 24, hash_[0]);
+        to_bytes (p + 32, hash_[1]);
+        to_bytes (p + 40, hash_[2]);
+        if (! IsFinalized ()) {
+            ::memcpy (p + 48, &buffer_[0], count_ & 0x3Fu);
         }
-        digest_t result;
-        to_bytes (&result[0], hash_[0]);
-        to_bytes (&result[8], hash_[1]);
-        to_bytes (&result[16], hash_[2]);
         return result;
     }
+
+    bool Generator::RestoreState (const savedstate_t &state) noexcept {
+        auto const p = state.data ();
+        if (::memcmp (p, saved_state_magic, sizeof (saved_state_magic)) != 0 || p[4] != saved_state_version) {
+            return false;
+        }
+        uint32_t const flags  = p[5];
+        size_t const   passes = static_cast<size_t> (p[6]) | (static_cast<size_t> (p[7]) << 8u);
+        if ((flags & ~((1u << BIT_FINALIZED) | (1u << BIT_TIGER2))) != 0 || passes < DEFAULT_PASSES || saved_state_max_passes < passes) {
+            return false;
+        }
+        if (as_uint64 (p + 8) != SBoxFingerprint (sbox_)) {
+            return false;
+        }
+        count_    = static_cast<size_t> (as_uint64 (p + 16));
+        flags_    = flags;
+        cntPass_  = passes;
+        compress_ = select_compress (passes);
+        hash_[0]  = as_uint64 (p + 24);
+        hash_[1]  = as_uint64 (p + 32);
+        hash_[2]  = as_uint64 (p + 40);
+        ::memcpy (&buffer_[0], p + 48, sizeof (buffer_));
+        return true;
+    }
+
+    template <size_t PASSES_, Padding PADDING_>
+    BasicGenerator<PASSES_, PADDING_>::BasicGenerator (const sbox_t &sbox) noexcept
+            : sbox_ {sbox}
+            , hash_ {{init_state_0, init_state_1, init_state_2}} {
+        /* NO-OP */
+    }
+
+    template <size_t PASSES_, Padding PADDING_>
+    BasicGenerator<PASSES_, PADDING_> &BasicGenerator<PASSES_, PADDING_>::Reset () noexcept {
+        count_     = 0;
+        finalized_ = false;
+        hash_      = state_t {{init_state_0, init_state_1, init_state_2}};
+        return *this;
+    }
+
+    template <size_t PASSES_, Padding PADDING_>
+    BasicGenerator<PASSES_, PADDING_> &BasicGenerator<PASSES_, PADDING_>::Update (const void *data, size_t size) noexcept {
+        CallProbe probe;
+        probe.Update (size);
+        update_buffered (buffer_, count_, data, size, [this, &probe] (const msgblock_t &block) {
+            probe.Compress ([&] () { CompressPasses<PASSES_> (hash_, block, sbox_); });
+        });
+        return *this;
+    }
+
+    template <size_t PASSES_, Padding PADDING_>
+    BasicGenerator<PASSES_, PADDING_> &BasicGenerator<PASSES_, PADDING_>::Update (uint8_t value) noexcept {
+        CallProbe probe;
+        probe.Update (1);
+        update_buffered (buffer_, count_, value, [this, &probe] (const msgblock_t &block) {
+            probe.Compress ([&] () { CompressPasses<PASSES_> (hash_, block, sbox_); });
+        });
+        return *this;
+    }
+
+    template <size_t PASSES_, Padding PADDING_>
+    BasicGenerator<PASSES_, PADDING_> &BasicGenerator<PASSES_, PADDING_>::UpdateV (const ByteView *segments, size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            Update (segments[i].data, segments[i].size);
+        }
+        return *this;
+    }
+
+    template <size_t PASSES_, Padding PADDING_>
+    digest_t BasicGenerator<PASSES_, PADDING_>::Finalize () noexcept {
+        if (! finalized_) {
+            CallProbe probe;
+            probe.Finalize ();
+            finalize_buffered (buffer_, count_, PADDING_ == Padding::Tiger2, [this, &probe] (const msgblock_t &block) {
+                probe.Compress ([&] () { CompressPasses<PASSES_> (hash_, block, sbox_); });
+            });
+            finalized_ = true;
+        }
+        return make_digest (hash_);
+    }
+
+    template <size_t PASSES_, Padding PADDING_>
+    digest_t BasicGenerator<PASSES_, PADDING_>::Peek () const noexcept {
+        if (finalized_) {
+            return make_digest (hash_);
+        }
+        state_t state = hash_;
+        finalize_buffered (buffer_, count_, PADDING_ == Padding::Tiger2, [this, &state] (const msgblock_t &block) {
+            CompressPasses<PASSES_> (state, block, sbox_);
+        });
+        return make_digest (state);
+    }
+
+    template class BasicGenerator<3, Padding::Tiger1>;
+    template class BasicGenerator<4, Padding::Tiger1>;
+    template class BasicGenerator<6, Padding::Tiger1>;
+    template class BasicGenerator<8, Padding::Tiger1>;
+    template class BasicGenerator<3, Padding::Tiger2>;
+    template class BasicGenerator<4, Padding::Tiger2>;
+    template class BasicGenerator<6, Padding::Tiger2>;
+    template class BasicGenerator<8, Padding::Tiger2>;
 }  // namespace Tiger
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "TreeHasher.hpp"
+
+#include "MultiGenerator.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Tiger {
+    using internal::ThreadPool;
+
+    namespace {
+        /// Height of the subtree hashed by a task (64 leaves = 64 KiB).
+        const size_t CHUNK_HEIGHT = 6;
+        const size_t CHUNK_LEAVES = static_cast<size_t> (1) << CHUNK_HEIGHT;
+        const size_t CHUNK_SIZE   = CHUNK_LEAVES * TreeHasher::LEAF_SIZE;
+
+        const uint8_t LEAF_PREFIX = 0x00;
+        const uint8_t NODE_PREFIX = 0x01;
+    }  // namespace
+
+    const size_t TreeHasher::LEAF_SIZE;
+
+    TreeHasher::TreeHasher (const sbox_t &sbox, size_t cntThread, size_t recordLevel)
+            : sbox_ {sbox}
+            , pool_ {new ThreadPool (cntThread)}
+            , recordLevel_ {recordLevel} {
+        /* NO-OP */
+    }
+
+    TreeHasher::~TreeHasher () = default;
+
+    TreeHasher &TreeHasher::Reset () noexcept {
+        cntLeaf_    = 0;
+        cntPending_ = 0;
+        finalized_  = false;
+        stack_.clear ();
+        recorded_.clear ();
+        return *this;
+    }
+
+    digest_t TreeHasher::HashLeaf (const void *data, size_t size) const noexcept {
+        assert (size <= LEAF_SIZE);
+        Generator gen (sbox_);
+        gen.Update (LEAF_PREFIX);
+        gen.Update (data, size);
+        return gen.Finalize ();
+    }
+
+    digest_t TreeHasher::HashNode (const digest_t &left, const digest_t &right) const noexcept {
+        Generator gen (sbox_);
+        gen.Update (NODE_PREFIX);
+        gen.Update (left.data (), left.size ());
+        gen.Update (right.data (), right.size ());
+        return gen.Finalize ();
+    }
+
+    TreeHasher &TreeHasher::Update (const void *data, size_t size) {
+        assert (! finalized_);
+        auto p = static_cast<const uint8_t *> (data);
+
+        if (0 < cntPending_) {
+            size_t n = std::min (size, LEAF_SIZE - cntPending_);
+            ::memcpy (&pending_[cntPending_], p, n);
+            cntPending_ += n;
+            p += n;
+            size -= n;
+            if (cntPending_ < LEAF_SIZE) {
+                return *this;
+            }
+            HashLeaves (pending_.data (), 1);
+            cntPending_ = 0;
+        }
+        size_t cntLeaf = size / LEAF_SIZE;
+        HashLeaves (p, cntLeaf);
+        p += LEAF_SIZE * cntLeaf;
+        size -= LEAF_SIZE * cntLeaf;
+        if (0 < size) {
+            ::memcpy (&pending_[0], p, size);
+            cntPending_ = size;
+        }
+        return *this;
+    }
+
+    digest_t TreeHasher::Finalize () {
+        if (! finalized_) {
+            if (0 < cntPending_ || cntLeaf_ == 0) {
+                // The last (short) leaf, or the empty one for the empty message.
+                Push (HashLeaf (pending_.data (), cntPending_), 0);
+                ++cntLeaf_;
+                cntPending_ = 0;
+            }
+            // Merges the remaining subtrees from the right edge.  The ones
+            // lower than the recorded level form its last (partial) node.
+            Node top = stack_.back ();
+            stack_.pop_back ();
+            bool partial = recordLevel_ != NO_LEVELS && top.height < recordLevel_;
+            while (! stack_.empty ()) {
+                auto const &left = stack_.back ();
+                if (partial && recordLevel_ <= left.height) {
+                    recorded_.emplace_back (top.digest);
+                    partial = false;
+                }
+                top = Node {HashNode (left.digest, top.digest), left.height + 1};
+                stack_.pop_back ();
+            }
+            if (partial) {
+                recorded_.emplace_back (top.digest);
+            }
+            root_      = top.digest;
+            finalized_ = true;
+        }
+        return root_;
+    }
+
+    std::vector<std::vector<digest_t>> TreeHasher::Levels () const {
+        assert (finalized_);
+        std::vector<std::vector<digest_t>> result;
+        if (recordLevel_ == NO_LEVELS) {
+            result.emplace_back (1, root_);
+            return result;
+        }
+        result.emplace_back (recorded_);
+        while (1 < result.back ().size ()) {
+            auto const           &lower = result.back ();
+            std::vector<digest_t> upper;
+            upper.reserve ((lower.size () + 1) / 2);
+            for (size_t i = 0; i + 1 < lower.size (); i += 2) {
+                upper.emplace_back (HashNode (lower[i], lower[i + 1]));
+            }
+            if (lower.size () % 2 != 0) {
+                upper.emplace_back (lower.back ());
+            }
+            result.emplace_back (std::move (upper));
+        }
+        assert (result.back ().front () == root_);
+        std::reverse (result.begin (), result.end ());
+        return result;
+    }
+
+    void TreeHasher::Push (const digest_t &digest, size_t height) {
+        if (height == recordLevel_) {
+            recorded_.emplace_back (digest);
+        }
+        Node node {digest, height};
+        while (! stack_.empty () && stack_.back ().height == node.height) {
+            node.digest = HashNode (stack_.back ().digest, node.digest);
+            ++node.height;
+            stack_.pop_back ();
+            if (node.height == recordLevel_) {
+                recorded_.emplace_back (node.digest);
+            }
+        }
+        stack_.emplace_back (node);
+    }
+
+    void TreeHasher::HashLeaves (const uint8_t *data, size_t cntLeaf) {
+        // Leaves up to the chunk boundary.
+        while (0 < cntLeaf && (cntLeaf_ % CHUNK_LEAVES) != 0) {
+            Push (HashLeaf (data, LEAF_SIZE), 0);
+            ++cntLeaf_;
+            data += LEAF_SIZE;
+            --cntLeaf;
+        }
+        // Complete chunks are reduced to subtrees in parallel.
+        size_t cntChunk = cntLeaf / CHUNK_LEAVES;
+        if (0 < cntChunk) {
+            size_t perChunk = (recordLevel_ < CHUNK_HEIGHT) ? (CHUNK_LEAVES >> recordLevel_) : 0;
+
+            std::vector<digest_t> roots (cntChunk);
+            std::vector<digest_t> nodes (cntChunk * perChunk);
+            // Leaves are hashed 8 at a time by the multi-lane kernels.
+            pool_->ParallelFor (cntChunk, [this, data, perChunk, &roots, &nodes] (size_t idx) {
+                const size_t                       LANES = MultiGenerator<8>::LANES;
+                MultiGenerator<8>                  multi (sbox_);
+                std::array<digest_t, CHUNK_LEAVES> level;
+                std::array<uint8_t, 1 + LEAF_SIZE> leaves[LANES];
+                std::array<const void *, LANES>    src;
+                std::array<size_t, LANES>          sizes;
+
+                auto const *p = data + CHUNK_SIZE * idx;
+                for (size_t i = 0; i < CHUNK_LEAVES; i += LANES) {
+                    for (size_t k = 0; k < LANES; ++k) {
+                        leaves[k][0] = LEAF_PREFIX;
+                        ::memcpy (&leaves[k][1], p + LEAF_SIZE * (i + k), LEAF_SIZE);
+                        src[k]   = leaves[k].data ();
+                        sizes[k] = leaves[k].size ();
+                    }
+                    multi.Hash (&level[i], src.data (), sizes.data (), LANES);
+                }
+                size_t cnt = CHUNK_LEAVES;
+                for (size_t h = 0; h < CHUNK_HEIGHT; ++h) {
+                    if (h == recordLevel_) {
+                        std::copy (level.begin (), level.begin () + cnt, nodes.begin () + perChunk * idx);
+                    }
+                    cnt /= 2;
+                    for (size_t i = 0; i < cnt; ++i) {
+                        level[i] = HashNode (level[2 * i], level[2 * i + 1]);
+                    }
+                }
+                roots[idx] = level[0];
+            });
+            for (size_t i = 0; i < cntChunk; ++i) {
+                recorded_.insert (recorded_.end (), nodes.begin () + perChunk * i, nodes.begin () + perChunk * (i + 1));
+                Push (roots[i], CHUNK_HEIGHT);
+                cntLeaf_ += CHUNK_LEAVES;
+            }
+            data += CHUNK_SIZE * cntChunk;
+            cntLeaf -= CHUNK_LEAVES * cntChunk;
+        }
+        // Leaves left.
+        while (0 < cntLeaf) {
+            Push (HashLeaf (data, LEAF_SIZE), 0);
+            ++cntLeaf_;
+            data += LEAF_SIZE;
+            --cntLeaf;
+        }
+    }
+}  // namespace Tiger
@@ -0,0 +1,67 @@
+
+#include <HashBatch.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test HashBatch") {
+    using namespace fmt::literals;
+
+    std::mt19937                      rng (10);
+    std::vector<std::vector<uint8_t>> messages;
+    std::vector<Tiger::ByteView>      inputs;
+    for (size_t i = 0; i < 1000; ++i) {
+        messages.emplace_back (rng () % (i % 3 == 0 ? 300 : 56));
+        for (auto &v : messages.back ()) {
+            v = static_cast<uint8_t> (rng ());
+        }
+    }
+    for (auto const &m : messages) {
+        inputs.push_back (Tiger::ByteView {m.data (), m.size ()});
+    }
+
+    auto check = [&] (const Tiger::HashBatchOptions &options) {
+        std::vector<Tiger::digest_t> result (inputs.size ());
+        Tiger::HashBatch (result.data (), inputs.data (), inputs.size (), options);
+        for (size_t i = 0; i < inputs.size (); ++i) {
+            Tiger::Generator gen (sbox (), options.passes, options.padding == Tiger::Padding::Tiger2);
+            gen.Update (inputs[i].data, inputs[i].size);
+            REQUIRE (result[i] == gen.Finalize ());
+        }
+    };
+
+    SUBCASE ("Known vectors") {
+        Tiger::ByteView                src[] = {{"", 0}, {"abc", 3}};
+        std::array<Tiger::digest_t, 2> result;
+        Tiger::HashBatch (result.data (), src, 2);
+        REQUIRE ("{}"_format (result[0]) == "3293AC630C13F0245F92BBB1766E16167A4E58492DDE73F3");
+        REQUIRE ("{}"_format (result[1]) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+    }
+    SUBCASE ("Single thread") {
+        check (Tiger::HashBatchOptions {});
+    }
+    SUBCASE ("Tiger2, 4 passes") {
+        Tiger::HashBatchOptions options;
+        options.passes  = 4;
+        options.padding = Tiger::Padding::Tiger2;
+        check (options);
+    }
+    SUBCASE ("Multiple threads") {
+        Tiger::HashBatchOptions options;
+        options.cntThread = 4;
+        options.grain     = 7;
+        check (options);
+    }
+    SUBCASE ("Empty batch") {
+        Tiger::HashBatchOptions options;
+        options.cntThread = 4;
+        Tiger::HashBatch (nullptr, nullptr, 0, options);
+    }
+}
@@ -0,0 +1,80 @@
+
+#include <tiger.h>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" int tiger_c_hash_abc (uint8_t *digest);
+
+namespace {
+    Tiger::digest_t to_digest (const uint8_t *bytes) {
+        Tiger::digest_t result;
+        ::memcpy (result.data (), bytes, result.size ());
+        return result;
+    }
+}  // namespace
+
+// Uses tiger.h alone: Also runs against the shared library (test-tiger-shared).
+TEST_CASE_FIXTURE (TigerFixture, "Test C interface") {
+    using namespace fmt::literals;
+
+    std::string const src ("abc");
+    uint8_t           digest[TIGER_DIGEST_SIZE];
+
+    SUBCASE ("tiger_hash") {
+        tiger_hash (src.data (), src.size (), digest);
+        REQUIRE ("{}"_format (to_digest (digest)) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+        tiger2_hash (src.data (), src.size (), digest);
+        REQUIRE ("{}"_format (to_digest (digest)) == "F68D7BC5AF4B43A06E048D7829560D4A9415658BB0B1F3BF");
+    }
+    SUBCASE ("tiger_hash_ex") {
+        uint8_t expected[TIGER_DIGEST_SIZE];
+        tiger2_hash (src.data (), src.size (), expected);
+        REQUIRE (tiger_hash_ex (src.data (), src.size (), 0, TIGER_PADDING_TIGER2, digest) == TIGER_OK);
+        REQUIRE (::memcmp (digest, expected, sizeof (digest)) == 0);
+        REQUIRE (tiger_hash_ex (src.data (), src.size (), 4, TIGER_PADDING_TIGER1, digest) == TIGER_OK);
+        REQUIRE (tiger_hash_ex (src.data (), src.size (), 2, TIGER_PADDING_TIGER1, digest) == TIGER_ERROR_ARGUMENT);
+        REQUIRE (tiger_hash_ex (src.data (), src.size (), 3, static_cast<tiger_padding> (7), digest) == TIGER_ERROR_ARGUMENT);
+    }
+    SUBCASE ("tiger_ctx") {
+        REQUIRE (tiger_c_hash_abc (digest) == TIGER_ABI_VERSION);
+        REQUIRE ("{}"_format (to_digest (digest)) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+
+        std::string const long_src (1000000, 'a');
+        tiger_ctx         ctx;
+        REQUIRE (tiger_ctx_init (&ctx, 0, TIGER_PADDING_TIGER1) == TIGER_OK);
+        tiger_ctx_update (&ctx, long_src.data (), 999);
+        tiger_ctx copy;
+        ::memcpy (&copy, &ctx, sizeof (ctx));  // Relocatable
+        tiger_ctx_update (&copy, long_src.data () + 999, long_src.size () - 999);
+        tiger_ctx_peek (&copy, digest);
+        REQUIRE ("{}"_format (to_digest (digest)) == "6DB0E2729CBEAD93D715C6A7D36302E9B3CEE0D2BC314B41");
+        tiger_ctx_final (&copy, digest);
+        REQUIRE ("{}"_format (to_digest (digest)) == "6DB0E2729CBEAD93D715C6A7D36302E9B3CEE0D2BC314B41");
+    }
+    SUBCASE ("tiger_hash_batch") {
+        std::vector<std::string> messages;
+        std::vector<tiger_view>  inputs;
+        for (size_t i = 0; i < 100; ++i) {
+            messages.emplace_back (i * 7, static_cast<char> ('a' + i % 26));
+        }
+        for (auto const &msg : messages) {
+            inputs.push_back (tiger_view {msg.data (), msg.size ()});
+        }
+        std::vector<uint8_t> digests (TIGER_DIGEST_SIZE * inputs.size ());
+        REQUIRE (tiger_hash_batch (digests.data (), inputs.data (), inputs.size (), 0, TIGER_PADDING_TIGER2, 2) == TIGER_OK);
+        for (size_t i = 0; i < messages.size (); ++i) {
+            tiger2_hash (messages[i].data (), messages[i].size (), digest);
+            REQUIRE (::memcmp (digests.data () + TIGER_DIGEST_SIZE * i, digest, sizeof (digest)) == 0);
+        }
+        REQUIRE (tiger_hash_batch (nullptr, inputs.data (), inputs.size (), 0, TIGER_PADDING_TIGER1, 1) == TIGER_ERROR_ARGUMENT);
+        REQUIRE (tiger_hash_batch (nullptr, nullptr, 0, 0, TIGER_PADDING_TIGER1, 1) == TIGER_OK);
+    }
+}
@@ -0,0 +1,17 @@
+/*
+ * Compiled as C: Checks that tiger.h is valid C and hashes through it.
+ */
+#include <tiger.h>
+
+#include <string.h>
+
+int tiger_c_hash_abc (uint8_t *digest) {
+    tiger_ctx ctx;
+    if (tiger_ctx_init (&ctx, 0, TIGER_PADDING_TIGER1) != TIGER_OK) {
+        return -1;
+    }
+    tiger_ctx_update (&ctx, "a", 1);
+    tiger_ctx_update (&ctx, "bc", 2);
+    tiger_ctx_final (&ctx, digest);
+    return (int)tiger_abi_version ();
+}
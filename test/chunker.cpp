@@ -0,0 +1,94 @@
+
+#include <Chunker.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+    /// Cuts the whole SRC.  Returns the chunk sizes.
+    std::vector<size_t> cut (const Tiger::Chunker &chunker, const std::vector<uint8_t> &src) {
+        std::vector<size_t> result;
+        for (size_t off = 0; off < src.size ();) {
+            auto n = chunker.Next (src.data () + off, src.size () - off);
+            result.emplace_back (n);
+            off += n;
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE_FIXTURE (TigerFixture, "Test Chunker") {
+    std::mt19937         rng (21);
+    std::vector<uint8_t> src (1u << 20u);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+    Tiger::Chunker chunker;
+
+    SUBCASE ("Sizes") {
+        auto const sizes = cut (chunker, src);
+        size_t     total = 0;
+        for (size_t i = 0; i < sizes.size (); ++i) {
+            REQUIRE (sizes[i] <= chunker.MaxSize ());
+            if (i + 1 < sizes.size ()) {
+                REQUIRE (chunker.MinSize () < sizes[i]);
+            }
+            total += sizes[i];
+        }
+        REQUIRE (total == src.size ());
+        // Roughly around the average.
+        auto const avg = src.size () / sizes.size ();
+        REQUIRE (chunker.AvgSize () / 2 < avg);
+        REQUIRE (avg < chunker.AvgSize () * 2);
+    }
+    SUBCASE ("Resynchronizes after an insertion") {
+        auto shifted = src;
+        shifted.insert (shifted.begin () + 1000, {1, 2, 3, 4, 5});
+
+        auto boundaries = [&chunker] (const std::vector<uint8_t> &data, size_t delta) {
+            std::set<size_t> result;
+            size_t           off = 0;
+            for (auto n : cut (chunker, data)) {
+                off += n;
+                result.insert (off - delta);
+            }
+            return result;
+        };
+        auto const expected = boundaries (src, 0);
+        auto const actual   = boundaries (shifted, 5);
+        size_t     common   = 0;
+        for (auto b : actual) {
+            common += expected.count (b);
+        }
+        REQUIRE (expected.size () - 3 <= common);
+    }
+    SUBCASE ("Options") {
+        Tiger::ChunkerOptions options;
+        options.minSize = 100;
+        options.avgSize = 1000;
+        options.maxSize = 500;
+        Tiger::Chunker clamped (options);
+        REQUIRE (clamped.AvgSize () == 512);
+        REQUIRE (clamped.MaxSize () == 512);
+        for (auto n : cut (clamped, src)) {
+            REQUIRE (n <= 512);
+        }
+    }
+    SUBCASE ("Huge sizes") {
+        Tiger::ChunkerOptions options;
+        options.minSize = SIZE_MAX;
+        options.avgSize = SIZE_MAX;
+        options.maxSize = SIZE_MAX;
+        Tiger::Chunker huge (options);
+        REQUIRE (huge.MinSize () == Tiger::Chunker::MAX_CHUNK_SIZE);
+        REQUIRE (huge.AvgSize () == static_cast<size_t> (1) << 31u);
+        REQUIRE (huge.MaxSize () == Tiger::Chunker::MAX_CHUNK_SIZE);
+    }
+}
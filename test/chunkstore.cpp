@@ -0,0 +1,145 @@
+
+#include <ChunkStore.hpp>
+#include <DigestIndex.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <system_error>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test DigestIndex") {
+    std::vector<Tiger::digest_t> digests;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        digests.emplace_back (Tiger::Hash (&i, sizeof (i)));
+    }
+    Tiger::DigestIndex index;
+    for (size_t i = 0; i < digests.size (); ++i) {
+        auto const inserted = index.Insert (digests[i], 1000 + i);
+        REQUIRE (inserted.second);
+        REQUIRE (inserted.first == 1000 + i);
+    }
+    REQUIRE (index.Size () == digests.size ());
+    REQUIRE (index.Size () * 8 <= index.Capacity () * 7);
+
+    SUBCASE ("Find") {
+        for (size_t i = 0; i < digests.size (); ++i) {
+            uint64_t value = 0;
+            REQUIRE (index.Find (digests[i], value));
+            REQUIRE (value == 1000 + i);
+        }
+        uint64_t value = 0;
+        REQUIRE (! index.Find (Tiger::Hash ("missing", 7), value));
+    }
+    SUBCASE ("Duplicates") {
+        auto const inserted = index.Insert (digests[17], 1);
+        REQUIRE (! inserted.second);
+        REQUIRE (inserted.first == 1017);
+        REQUIRE (index.Size () == digests.size ());
+    }
+    SUBCASE ("Save") {
+        const char *path = "test-tiger-digestindex.tmp";
+        index.Save (path);
+
+        auto const loaded = Tiger::DigestIndex::Load (path);
+        REQUIRE (loaded.Size () == index.Size ());
+
+        Tiger::MappedDigestIndex mapped (path);
+        REQUIRE (mapped.Size () == index.Size ());
+        for (size_t i = 0; i < digests.size (); ++i) {
+            uint64_t value = 0;
+            REQUIRE (loaded.Find (digests[i], value));
+            REQUIRE (value == 1000 + i);
+            REQUIRE (mapped.Find (digests[i], value));
+            REQUIRE (value == 1000 + i);
+        }
+        uint64_t value = 0;
+        REQUIRE (! mapped.Find (Tiger::Hash ("missing", 7), value));
+
+        Tiger::DigestIndex ().Save (path);
+        REQUIRE (! Tiger::MappedDigestIndex (path).Find (digests[0], value));
+
+        auto fp = std::fopen (path, "wb");
+        std::fputs ("garbage", fp);
+        std::fclose (fp);
+        CHECK_THROWS_AS (Tiger::MappedDigestIndex {path}, std::system_error);
+        CHECK_THROWS_AS (Tiger::DigestIndex::Load (path), std::system_error);
+        std::remove (path);
+    }
+    SUBCASE ("Full table") {
+        // A group without an empty slot (a valid header otherwise) could not be written by Save.
+        const char          *path = "test-tiger-digestindex-full.tmp";
+        std::vector<uint8_t> contents {'T', 'G', 'R', 'D', 'I', 'D', 'X', '1'};
+        contents.resize (32);
+        contents[8]  = 1;   // # of groups
+        contents[16] = 15;  // # of entries
+        contents.resize (contents.size () + Tiger::DigestIndex::GROUP_SIZE, 0xFFu);
+        contents.resize (contents.size () + Tiger::DigestIndex::GROUP_SIZE * sizeof (Tiger::DigestIndex::Entry), 0);
+        auto fp = std::fopen (path, "wb");
+        std::fwrite (contents.data (), 1, contents.size (), fp);
+        std::fclose (fp);
+
+        CHECK_THROWS_AS (Tiger::DigestIndex::Load (path), std::system_error);
+        Tiger::MappedDigestIndex mapped (path);
+        uint64_t                 value = 0;
+        REQUIRE (! mapped.Find (digests[0], value));
+        std::remove (path);
+    }
+}
+
+TEST_CASE_FIXTURE (TigerFixture, "Test ChunkStore") {
+    std::mt19937         rng (21);
+    std::vector<uint8_t> src (1u << 20u);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+    Tiger::ChunkStoreOptions options;
+    options.cntThread = 2;
+    Tiger::ChunkStore store (options);
+
+    std::vector<Tiger::ChunkRef> first;
+    REQUIRE (store.Ingest (src.data (), src.size (), true, first) == src.size ());
+    uint64_t offset = 0;
+    for (size_t i = 0; i < first.size (); ++i) {
+        REQUIRE (first[i].isNew);
+        REQUIRE (first[i].id == i);
+        REQUIRE (first[i].offset == offset);
+        REQUIRE (first[i].digest == Tiger::Hash (src.data () + offset, first[i].size));
+        offset += first[i].size;
+    }
+
+    SUBCASE ("Duplicated stream") {
+        std::vector<Tiger::ChunkRef> second;
+        store.Ingest (src.data (), src.size (), true, second);
+        REQUIRE (second.size () == first.size ());
+        for (size_t i = 0; i < second.size (); ++i) {
+            REQUIRE (! second[i].isNew);
+            REQUIRE (second[i].id == first[i].id);
+        }
+        REQUIRE (store.Index ().Size () == first.size ());
+        REQUIRE (store.Offset () == 2 * src.size ());
+    }
+    SUBCASE ("Streamed in pieces") {
+        Tiger::ChunkStore            streamed (options);
+        std::vector<Tiger::ChunkRef> result;
+        std::vector<uint8_t>         pending;
+        for (size_t off = 0; off < src.size (); off += 10000) {
+            auto const end = std::min (src.size (), off + 10000);
+            pending.insert (pending.end (), src.begin () + off, src.begin () + end);
+            auto n = streamed.Ingest (pending.data (), pending.size (), end == src.size (), result);
+            pending.erase (pending.begin (), pending.begin () + n);
+        }
+        REQUIRE (pending.empty ());
+        REQUIRE (result.size () == first.size ());
+        for (size_t i = 0; i < result.size (); ++i) {
+            REQUIRE (result[i].digest == first[i].digest);
+            REQUIRE (result[i].offset == first[i].offset);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+
+#include <ContextPool.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test Context") {
+    static_assert (std::is_trivially_copyable<Tiger::Context>::value, "Context should be trivially copyable");
+
+    std::mt19937         rng (22);
+    std::vector<uint8_t> src (1000);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+
+    SUBCASE ("Same as Generator") {
+        for (size_t passes : {3, 4, 5}) {
+            for (bool isTiger2 : {false, true}) {
+                Tiger::Generator gen (sbox (), passes, isTiger2);
+                auto const       expected = gen.Update (src.data (), src.size ()).Finalize ();
+
+                Tiger::Context ctx;
+                ctx.Reset (passes, isTiger2 ? Tiger::Padding::Tiger2 : Tiger::Padding::Tiger1);
+                for (size_t off = 0, n = 1; off < src.size (); off += n, n = n * 2 + 1) {
+                    ctx.Update (sbox (), src.data () + off, std::min (n, src.size () - off));
+                    REQUIRE (ctx.count == off + std::min (n, src.size () - off));
+                }
+                REQUIRE (ctx.Peek (sbox ()) == expected);
+                REQUIRE (ctx.Finalize (sbox ()) == expected);
+                REQUIRE (ctx.IsFinalized ());
+                REQUIRE (ctx.Finalize (sbox ()) == expected);
+            }
+        }
+    }
+    SUBCASE ("Default SBox") {
+        using namespace fmt::literals;
+        Tiger::Context ctx;
+        REQUIRE ("{}"_format (ctx.Reset ().Update ("abc", 3).Finalize ()) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+    }
+    SUBCASE ("Copied in the middle") {
+        Tiger::Context ctx;
+        ctx.Reset ().Update (src.data (), 100);
+
+        Tiger::Context moved;
+        std::memcpy (&moved, &ctx, sizeof (moved));
+        auto copied = ctx;
+        ctx.Update (src.data () + 100, 900);
+        moved.Update (src.data () + 100, 900);
+        copied.Update (src.data () + 100, 50);
+
+        auto const expected = Tiger::Hash (src.data (), src.size ());
+        REQUIRE (ctx.Finalize () == expected);
+        REQUIRE (moved.Finalize () == expected);
+        REQUIRE (copied.Finalize () == Tiger::Hash (src.data (), 150));
+    }
+}
+
+TEST_CASE_FIXTURE (TigerFixture, "Test ContextPool") {
+    Tiger::ContextPool pool;
+    REQUIRE (pool.Capacity () == 0);
+
+    std::vector<Tiger::Context *> contexts;
+    for (size_t i = 0; i < Tiger::ContextPool::SLAB_SIZE + 10; ++i) {
+        contexts.emplace_back (pool.Acquire ());
+        contexts.back ()->Update (&i, sizeof (i));
+    }
+    REQUIRE (pool.Size () == contexts.size ());
+    REQUIRE (pool.Capacity () == 2 * Tiger::ContextPool::SLAB_SIZE);
+    for (size_t i = 0; i < contexts.size (); ++i) {
+        REQUIRE (contexts[i]->Finalize () == Tiger::Hash (&i, sizeof (i)));
+    }
+
+    SUBCASE ("Recycled") {
+        auto released = contexts[5];
+        pool.Release (released);
+        REQUIRE (pool.Size () == contexts.size () - 1);
+
+        auto reused = pool.Acquire (4, Tiger::Padding::Tiger2);
+        REQUIRE (reused == released);
+        REQUIRE (! reused->IsFinalized ());
+        REQUIRE (reused->IsTiger2 ());
+        REQUIRE (reused->passes == 4);
+        REQUIRE (reused->count == 0);
+        REQUIRE (pool.Capacity () == 2 * Tiger::ContextPool::SLAB_SIZE);
+    }
+    SUBCASE ("Preallocated") {
+        Tiger::ContextPool preallocated (10000);
+        REQUIRE (preallocated.Capacity () == 3 * Tiger::ContextPool::SLAB_SIZE);
+        for (size_t i = 0; i < 10000; ++i) {
+            preallocated.Acquire ();
+        }
+        REQUIRE (preallocated.Capacity () == 3 * Tiger::ContextPool::SLAB_SIZE);
+        REQUIRE (preallocated.Size () == 10000);
+    }
+}
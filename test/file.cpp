@@ -0,0 +1,148 @@
+
+#include <HashFile.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+    /** A temporary file removed on exit.  */
+    class TemporaryFile {
+        std::string path_;
+
+    public:
+        TemporaryFile (const std::string &path, const std::vector<uint8_t> &contents) : path_ {path} {
+            auto fp = std::fopen (path_.c_str (), "wb");
+            REQUIRE (fp != nullptr);
+            if (! contents.empty ()) {
+                std::fwrite (contents.data (), 1, contents.size (), fp);
+            }
+            std::fclose (fp);
+        }
+        ~TemporaryFile () { std::remove (path_.c_str ()); }
+
+        const std::string &Path () const { return path_; }
+    };
+}  // namespace
+
+TEST_CASE_FIXTURE (TigerFixture, "Test HashFile") {
+    std::mt19937         rng (3);
+    std::vector<uint8_t> src (3 * 1024 * 1024 + 17);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+    TemporaryFile file ("test-tiger-hashfile.tmp", src);
+
+    // The padding loops run inside the subcases (doctest enters a subcase once per run).
+    auto expected = [this, &src] (bool isTiger2) {
+        Tiger::Generator gen (sbox (), Tiger::DEFAULT_PASSES, isTiger2);
+        return gen.Update (src.data (), src.size ()).Finalize ();
+    };
+    auto options_for = [] (bool isTiger2) {
+        Tiger::HashFileOptions options;
+        options.padding = isTiger2 ? Tiger::Padding::Tiger2 : Tiger::Padding::Tiger1;
+        return options;
+    };
+
+    SUBCASE ("Mapped") {
+        for (auto isTiger2 : {false, true}) {
+            auto const result = Tiger::HashFile (file.Path (), options_for (isTiger2));
+            REQUIRE (result.digest == expected (isTiger2));
+            REQUIRE (result.size == src.size ());
+        }
+    }
+    SUBCASE ("Read-ahead") {
+        for (auto isTiger2 : {false, true}) {
+            auto options       = options_for (isTiger2);
+            options.useMmap    = false;
+            options.bufferSize = 4096 + 3;
+            options.cntBuffer  = 3;
+
+            auto const result = Tiger::HashFile (file.Path (), options);
+            REQUIRE (! result.mapped);
+            REQUIRE (result.digest == expected (isTiger2));
+            REQUIRE (result.size == src.size ());
+        }
+    }
+    SUBCASE ("Empty file") {
+        using namespace fmt::literals;
+        TemporaryFile empty ("test-tiger-hashfile-empty.tmp", std::vector<uint8_t> {});
+
+        auto const result = Tiger::HashFile (empty.Path ());
+        REQUIRE ("{}"_format (result.digest) == "3293AC630C13F0245F92BBB1766E16167A4E58492DDE73F3");
+        REQUIRE (result.size == 0);
+    }
+    SUBCASE ("Missing file") {
+        CHECK_THROWS_AS (Tiger::HashFile (file.Path () + ".missing"), std::system_error);
+    }
+}
+
+TEST_CASE_FIXTURE (TigerFixture, "Test FileTail") {
+    const char *path = "test-tiger-filetail.tmp";
+
+    std::mt19937         rng (14);
+    std::vector<uint8_t> src (100000);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+    auto append = [path] (const uint8_t *data, size_t size, const char *mode) {
+        auto fp = std::fopen (path, mode);
+        REQUIRE (fp != nullptr);
+        if (0 < size) {
+            std::fwrite (data, 1, size, fp);
+        }
+        std::fclose (fp);
+    };
+    auto expected = [this, &src] (size_t size) {
+        Tiger::Generator gen (sbox ());
+        return gen.Update (src.data (), size).Finalize ();
+    };
+    TemporaryFile file (path, std::vector<uint8_t> {});
+
+    Tiger::HashFileOptions options;
+    options.bufferSize = 4096 + 5;
+    Tiger::FileTail tail (path, options);
+
+    SUBCASE ("Appended") {
+        size_t size = 0;
+        for (size_t n : {0, 1, 63, 64, 1000, 30000, 68872}) {
+            append (src.data () + size, n, "ab");
+            size += n;
+            auto const result = tail.Refresh ();
+            REQUIRE (result.digest == expected (size));
+            REQUIRE (result.size == size);
+            REQUIRE (result.appended == n);
+            REQUIRE (! result.restarted);
+        }
+    }
+    SUBCASE ("Truncated") {
+        append (src.data (), 5000, "ab");
+        tail.Refresh ();
+        append (src.data (), 100, "wb");
+        auto const result = tail.Refresh ();
+        REQUIRE (result.restarted);
+        REQUIRE (result.digest == expected (100));
+    }
+    SUBCASE ("Resumed") {
+        append (src.data (), 777, "ab");
+        tail.Refresh ();
+        auto const saved = tail.SaveState ();
+        append (src.data () + 777, 1000, "ab");
+
+        Tiger::FileTail resumed (path, options);
+        REQUIRE (resumed.RestoreState (saved));
+        REQUIRE (resumed.Offset () == 777);
+        auto const result = resumed.Refresh ();
+        REQUIRE (result.appended == 1000);
+        REQUIRE (result.digest == expected (1777));
+    }
+}
@@ -3,12 +3,6 @@
 #include <Tiger.hpp>
 
 class TigerFixture {
-    Tiger::sbox_t   sbox_ ;
-
 public:
-    TigerFixture () {
-        Tiger::InitializeSBox (sbox_);
-    }
-
-    const Tiger::sbox_t & sbox () const { return sbox_ ; }
+    const Tiger::sbox_t & sbox () const { return Tiger::DefaultSBox () ; }
 } ;
@@ -0,0 +1,85 @@
+
+#include <Hmac.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+    /// HMAC by the definition (re-hashing the key blocks).
+    Tiger::digest_t reference_hmac (const Tiger::sbox_t &sbox, const std::vector<uint8_t> &key, const uint8_t *data, size_t size, size_t passes, bool isTiger2) {
+        std::vector<uint8_t> k (Tiger::Hmac::BLOCK_SIZE, 0);
+        if (Tiger::Hmac::BLOCK_SIZE < key.size ()) {
+            auto const digest = Tiger::Generator (sbox, passes, isTiger2).Update (key.data (), key.size ()).Finalize ();
+            std::copy (digest.begin (), digest.end (), k.begin ());
+        }
+        else {
+            std::copy (key.begin (), key.end (), k.begin ());
+        }
+        std::vector<uint8_t> ipad (k);
+        std::vector<uint8_t> opad (k);
+        for (size_t i = 0; i < k.size (); ++i) {
+            ipad[i] ^= 0x36u;
+            opad[i] ^= 0x5Cu;
+        }
+        auto const inner = Tiger::Generator (sbox, passes, isTiger2).Update (ipad.data (), ipad.size ()).Update (data, size).Finalize ();
+        return Tiger::Generator (sbox, passes, isTiger2).Update (opad.data (), opad.size ()).Update (inner.data (), inner.size ()).Finalize ();
+    }
+}  // namespace
+
+TEST_CASE_FIXTURE (TigerFixture, "Test Hmac") {
+    using namespace fmt::literals;
+
+    std::mt19937         rng (20);
+    std::vector<uint8_t> src (1000);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+
+    SUBCASE ("Known answer") {
+        std::vector<uint8_t> key (20, 0x0B);
+        Tiger::Hmac          hmac (key.data (), key.size ());
+        REQUIRE ("{}"_format (hmac.Mac ("Hi There", 8)) == "1D7A658C75F8F004916E7B07E2A2E10AEC7DE2AE124D3647");
+    }
+    SUBCASE ("Same as the definition") {
+        for (size_t keySize : {0, 1, 24, 63, 64, 65, 200}) {
+            std::vector<uint8_t> key (src.begin (), src.begin () + keySize);
+            for (size_t passes : {3, 4}) {
+                for (bool isTiger2 : {false, true}) {
+                    Tiger::Hmac hmac (sbox (), key.data (), key.size (), passes, isTiger2 ? Tiger::Padding::Tiger2 : Tiger::Padding::Tiger1);
+                    for (size_t size : {0, 1, 55, 56, 64, 100, 1000}) {
+                        REQUIRE (hmac.Mac (src.data (), size) == reference_hmac (sbox (), key, src.data (), size, passes, isTiger2));
+                    }
+                }
+            }
+        }
+    }
+    SUBCASE ("Batch") {
+        Tiger::Hmac                  hmac ("secret", 6);
+        std::vector<Tiger::ByteView> inputs;
+        for (size_t i = 0; i < 150; ++i) {
+            auto size = rng () % src.size ();
+            inputs.push_back (Tiger::ByteView {src.data () + (src.size () - size), size});
+        }
+        std::vector<Tiger::digest_t> result (inputs.size ());
+        hmac.Mac (result.data (), inputs.data (), inputs.size ());
+        for (size_t i = 0; i < inputs.size (); ++i) {
+            REQUIRE (result[i] == hmac.Mac (inputs[i].data, inputs[i].size));
+        }
+    }
+    SUBCASE ("Verify") {
+        Tiger::Hmac hmac ("secret", 6);
+        auto        mac = hmac.Mac (src.data (), src.size ());
+        REQUIRE (hmac.Verify (mac, src.data (), src.size ()));
+        REQUIRE (! hmac.Verify (mac, src.data (), src.size () - 1));
+        mac[23] ^= 1u;
+        REQUIRE (! hmac.Verify (mac, src.data (), src.size ()));
+        REQUIRE (! Tiger::DigestEqual (mac, hmac.Mac (src.data (), src.size ())));
+    }
+}
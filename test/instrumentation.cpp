@@ -0,0 +1,67 @@
+
+#include <Instrumentation.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test instrumentation counters") {
+    std::vector<uint8_t> src (1000, 'a');
+
+    auto const before = Tiger::ThreadCounters ();
+    {
+        Tiger::Generator gen (sbox ());
+        gen.Update (src.data (), 0);
+        gen.Update (src.data (), 1);
+        gen.Update (src.data (), 100);
+        gen.Update (src.data (), src.size ());
+        gen.Update ('x');
+        gen.Finalize ();
+        gen.Finalize ();
+    }
+    auto const after = Tiger::ThreadCounters ();
+
+    if (! Tiger::InstrumentationEnabled ()) {
+        REQUIRE (after.updates == 0);
+        REQUIRE (Tiger::CollectCounters ().blocks == 0);
+        return;
+    }
+    SUBCASE ("Per thread") {
+        REQUIRE (after.updates - before.updates == 5);
+        REQUIRE (after.bytes - before.bytes == 1102);
+        REQUIRE (after.finalizes - before.finalizes == 1);
+        // 1102 bytes: 17 full blocks and 2 final ones (46 bytes left with the padding)
+        REQUIRE (after.blocks - before.blocks == 18);
+        REQUIRE (after.updateSizes[0] - before.updateSizes[0] == 1);
+        REQUIRE (after.updateSizes[1] - before.updateSizes[1] == 2);
+        REQUIRE (after.updateSizes[7] - before.updateSizes[7] == 1);
+        REQUIRE (after.updateSizes[10] - before.updateSizes[10] == 1);
+    }
+    SUBCASE ("Registry") {
+        auto const total = Tiger::CollectCounters ().blocks;
+        std::thread ([this] () {
+            Tiger::BasicGenerator<3> gen (sbox ());
+            gen.Update ("abc", 3).Finalize ();
+        }).join ();
+        REQUIRE (Tiger::CollectCounters ().blocks == total + 1);
+
+        size_t cntThread = 0;
+        Tiger::VisitCounters ([&cntThread] (std::thread::id, const Tiger::Counters &) { ++cntThread; });
+        REQUIRE (1 <= cntThread);
+
+        Tiger::ResetCounters ();
+        REQUIRE (Tiger::CollectCounters ().blocks == 0);
+    }
+    SUBCASE ("Cycle timing") {
+        Tiger::EnableCycleTiming (true);
+        Tiger::Generator gen (sbox ());
+        gen.Update (src.data (), src.size ()).Finalize ();
+        Tiger::EnableCycleTiming (false);
+        REQUIRE (after.cycles < Tiger::ThreadCounters ().cycles);
+    }
+}
@@ -0,0 +1,95 @@
+
+#include <Kernel.hpp>
+#include <MultiGenerator.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<std::vector<uint8_t>> make_messages (size_t count) {
+        std::mt19937                      rng (12345);
+        std::vector<std::vector<uint8_t>> result;
+        for (size_t i = 0; i < count; ++i) {
+            // Mixes short tails (incl. 56..63 bytes ones) with longer records.
+            std::vector<uint8_t> msg (i < 130 ? i : rng () % 4000);
+            for (auto &v : msg) {
+                v = static_cast<uint8_t> (rng ());
+            }
+            result.emplace_back (std::move (msg));
+        }
+        return result;
+    }
+
+    template <size_t N_>
+    void check_lanes (const Tiger::sbox_t &sbox, size_t passes, bool isTiger2, size_t count) {
+        auto const messages = make_messages (count);
+
+        std::vector<const void *> data;
+        std::vector<size_t>       sizes;
+        for (auto const &msg : messages) {
+            data.emplace_back (msg.data ());
+            sizes.emplace_back (msg.size ());
+        }
+        std::vector<Tiger::digest_t> result (count);
+        Tiger::MultiGenerator<N_>    multi (sbox, passes, isTiger2);
+        multi.Hash (result.data (), data.data (), sizes.data (), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            Tiger::Generator gen (sbox, passes, isTiger2);
+            gen.Update (messages[i].data (), messages[i].size ());
+            REQUIRE (result[i] == gen.Finalize ());
+        }
+    }
+}  // namespace
+
+TEST_CASE_FIXTURE (TigerFixture, "Test MultiGenerator") {
+    using namespace fmt::literals;
+
+    SUBCASE ("2 lanes") {
+        check_lanes<2> (sbox (), Tiger::DEFAULT_PASSES, false, 200);
+        check_lanes<2> (sbox (), Tiger::DEFAULT_PASSES, true, 200);
+    }
+    SUBCASE ("4 lanes") {
+        check_lanes<4> (sbox (), Tiger::DEFAULT_PASSES, false, 200);
+        check_lanes<4> (sbox (), Tiger::DEFAULT_PASSES, true, 200);
+    }
+    SUBCASE ("8 lanes") {
+        check_lanes<8> (sbox (), Tiger::DEFAULT_PASSES, false, 200);
+        check_lanes<8> (sbox (), Tiger::DEFAULT_PASSES, true, 200);
+    }
+    SUBCASE ("Extra passes") {
+        check_lanes<4> (sbox (), 5, false, 50);
+        check_lanes<4> (sbox (), 5, true, 50);
+    }
+    SUBCASE ("Fewer messages than lanes") {
+        check_lanes<8> (sbox (), Tiger::DEFAULT_PASSES, false, 3);
+        check_lanes<8> (sbox (), Tiger::DEFAULT_PASSES, false, 1);
+        check_lanes<8> (sbox (), Tiger::DEFAULT_PASSES, false, 0);
+    }
+    SUBCASE ("All kernels") {
+        for (auto kernel : {Tiger::Kernel::Portable, Tiger::Kernel::SSE42, Tiger::Kernel::AVX2, Tiger::Kernel::AVX512}) {
+            if (Tiger::SelectKernel (kernel)) {
+                REQUIRE (Tiger::ActiveKernel () == kernel);
+                check_lanes<2> (sbox (), Tiger::DEFAULT_PASSES, false, 100);
+                check_lanes<4> (sbox (), Tiger::DEFAULT_PASSES, true, 100);
+                check_lanes<8> (sbox (), Tiger::DEFAULT_PASSES, false, 100);
+                check_lanes<8> (sbox (), 4, true, 30);
+            }
+        }
+        REQUIRE (Tiger::SelectKernel (Tiger::Kernel::Auto));
+    }
+    SUBCASE ("Known vectors") {
+        Tiger::MultiGenerator<2> multi (sbox ());
+
+        auto const result = multi.Hash ({{"", "abc"}}, {{0, 3}});
+        REQUIRE ("{}"_format (result[0]) == "3293AC630C13F0245F92BBB1766E16167A4E58492DDE73F3");
+        REQUIRE ("{}"_format (result[1]) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+    }
+}
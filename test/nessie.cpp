@@ -0,0 +1,102 @@
+
+#include <HashBatch.hpp>
+#include <Kernel.hpp>
+#include <MultiGenerator.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+    /// Hashes SRC on every path and returns the digests (which should be the same).
+    std::vector<Tiger::digest_t> hash_everywhere (const Tiger::sbox_t &sbox, const std::string &src, bool isTiger2) {
+        auto const                   padding = isTiger2 ? Tiger::Padding::Tiger2 : Tiger::Padding::Tiger1;
+        std::vector<Tiger::digest_t> result;
+
+        result.emplace_back (Tiger::Generator (sbox, Tiger::DEFAULT_PASSES, isTiger2).Update (src.data (), src.size ()).Finalize ());
+        result.emplace_back (isTiger2 ? Tiger::Hash2 (sbox, src.data (), src.size ()) : Tiger::Hash (sbox, src.data (), src.size ()));
+        {
+            // Odd sized pieces crossing the block boundaries.
+            Tiger::Generator gen (sbox, Tiger::DEFAULT_PASSES, isTiger2);
+            for (size_t off = 0; off < src.size (); off += 8191) {
+                gen.Update (src.data () + off, std::min<size_t> (8191, src.size () - off));
+            }
+            result.emplace_back (gen.Finalize ());
+        }
+        {
+            std::vector<Tiger::ByteView> segments;
+            for (size_t off = 0, n = 1; off < src.size (); off += n, n = n * 3 + 1) {
+                segments.push_back (Tiger::ByteView {src.data () + off, std::min (n, src.size () - off)});
+            }
+            result.emplace_back (Tiger::Generator (sbox, Tiger::DEFAULT_PASSES, isTiger2).UpdateV (segments.data (), segments.size ()).Finalize ());
+        }
+        if (isTiger2) {
+            result.emplace_back (Tiger::BasicGenerator<3, Tiger::Padding::Tiger2> (sbox).Update (src.data (), src.size ()).Finalize ());
+        }
+        else {
+            result.emplace_back (Tiger::BasicGenerator<3, Tiger::Padding::Tiger1> (sbox).Update (src.data (), src.size ()).Finalize ());
+        }
+        {
+            Tiger::Context ctx;
+            ctx.Reset (Tiger::DEFAULT_PASSES, padding);
+            result.emplace_back (ctx.Update (sbox, src.data (), src.size ()).Finalize (sbox));
+        }
+        {
+            std::vector<Tiger::ByteView> views (3, Tiger::ByteView {src.data (), src.size ()});
+            std::vector<Tiger::digest_t> digests (views.size ());
+            Tiger::HashBatchOptions      options;
+            options.sbox    = &sbox;
+            options.padding = padding;
+            Tiger::HashBatch (digests.data (), views.data (), views.size (), options);
+            result.insert (result.end (), digests.begin (), digests.end ());
+        }
+        for (auto kernel : {Tiger::Kernel::Portable, Tiger::Kernel::SSE42, Tiger::Kernel::AVX2, Tiger::Kernel::AVX512}) {
+            if (! Tiger::SelectKernel (kernel)) {
+                continue;
+            }
+            Tiger::MultiGenerator<8> multi (sbox, Tiger::DEFAULT_PASSES, isTiger2);
+            const void *             data[2]  = {src.data (), src.data ()};
+            size_t                   sizes[2] = {src.size (), src.size ()};
+            Tiger::digest_t          digests[2];
+            multi.Hash (digests, data, sizes, 2);
+            result.insert (result.end (), digests, digests + 2);
+        }
+        Tiger::SelectKernel (Tiger::Kernel::Auto);
+        return result;
+    }
+}  // namespace
+
+// The long messages of the NESSIE test vectors on every path (the kernels
+// included).  The same digests are produced by the reference
+// implementation in fuzz/Reference.cpp.
+TEST_CASE_FIXTURE (TigerFixture, "Test NESSIE long messages") {
+    using namespace fmt::literals;
+
+    SUBCASE ("\"1234567890\" * 8") {
+        std::string src;
+        for (int i = 0; i < 8; ++i) {
+            src.append ("1234567890");
+        }
+        for (auto const &digest : hash_everywhere (sbox (), src, false)) {
+            REQUIRE ("{}"_format (digest) == "1C14795529FD9F207A958F84C52F11E887FA0CABDFD91BFD");
+        }
+        for (auto const &digest : hash_everywhere (sbox (), src, true)) {
+            REQUIRE ("{}"_format (digest) == "D85278115329EBAA0EEC85ECDC5396FDA8AA3A5820942FFF");
+        }
+    }
+    SUBCASE ("1 million \"a\"") {
+        std::string src (1000000, 'a');
+        for (auto const &digest : hash_everywhere (sbox (), src, false)) {
+            REQUIRE ("{}"_format (digest) == "6DB0E2729CBEAD93D715C6A7D36302E9B3CEE0D2BC314B41");
+        }
+        for (auto const &digest : hash_everywhere (sbox (), src, true)) {
+            REQUIRE ("{}"_format (digest) == "E068281F060F551628CC5715B9D0226796914D45F7717CF4");
+        }
+    }
+}
@@ -0,0 +1,35 @@
+
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test Hash/Hash2") {
+    using namespace fmt::literals;
+
+    SUBCASE ("Known vectors") {
+        REQUIRE ("{}"_format (Tiger::Hash ("", 0)) == "3293AC630C13F0245F92BBB1766E16167A4E58492DDE73F3");
+        REQUIRE ("{}"_format (Tiger::Hash ("abc", 3)) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+        REQUIRE ("{}"_format (Tiger::Hash2 ("", 0)) == "4441BE75F6018773C206C22745374B924AA8313FEF919F41");
+        REQUIRE ("{}"_format (Tiger::Hash2 ("abc", 3)) == "F68D7BC5AF4B43A06E048D7829560D4A9415658BB0B1F3BF");
+    }
+    SUBCASE ("Same as Generator") {
+        std::mt19937         rng (11);
+        std::vector<uint8_t> src (200);
+        for (auto &v : src) {
+            v = static_cast<uint8_t> (rng ());
+        }
+        for (size_t size = 0; size <= src.size (); ++size) {
+            Tiger::Generator gen (sbox ());
+            Tiger::Generator gen2 (sbox (), Tiger::DEFAULT_PASSES, true);
+            REQUIRE (Tiger::Hash (sbox (), src.data (), size) == gen.Update (src.data (), size).Finalize ());
+            REQUIRE (Tiger::Hash2 (sbox (), src.data (), size) == gen2.Update (src.data (), size).Finalize ());
+        }
+    }
+}
@@ -0,0 +1,65 @@
+
+#include <MultiGenerator.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+    /// Compares BasicGenerator against Generator and the (loop based) multi-lane compression.
+    template <size_t PASSES_, Tiger::Padding PADDING_>
+    void check_passes (const Tiger::sbox_t &sbox) {
+        auto const   isTiger2 = PADDING_ == Tiger::Padding::Tiger2;
+        std::mt19937 rng (PASSES_);
+
+        for (size_t size = 0; size < 300; size += 7) {
+            std::vector<uint8_t> src (size);
+            for (auto &v : src) {
+                v = static_cast<uint8_t> (rng ());
+            }
+            Tiger::BasicGenerator<PASSES_, PADDING_> basic (sbox);
+            Tiger::Generator                         gen (sbox, PASSES_, isTiger2);
+            Tiger::MultiGenerator<2>                 multi (sbox, PASSES_, isTiger2);
+            basic.Update (src.data (), src.size ());
+            gen.Update (src.data (), src.size ());
+
+            auto const expected = multi.Hash ({{src.data (), src.data ()}}, {{src.size (), src.size ()}});
+            auto const result   = basic.Finalize ();
+            REQUIRE (result == expected[0]);
+            REQUIRE (result == gen.Finalize ());
+        }
+    }
+}  // namespace
+
+TEST_CASE_FIXTURE (TigerFixture, "Test BasicGenerator") {
+    using namespace fmt::literals;
+
+    SUBCASE ("abc") {
+        Tiger::BasicGenerator<3> gen (sbox ());
+        gen.Update ("abc", 3);
+
+        REQUIRE ("{}"_format (gen.Finalize ()) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+    }
+    SUBCASE ("abc (Type 2)") {
+        Tiger::BasicGenerator<3, Tiger::Padding::Tiger2> gen (sbox ());
+        gen.Update ("abc", 3);
+
+        REQUIRE ("{}"_format (gen.Finalize ()) == "F68D7BC5AF4B43A06E048D7829560D4A9415658BB0B1F3BF");
+    }
+    SUBCASE ("Instantiated passes") {
+        check_passes<3, Tiger::Padding::Tiger1> (sbox ());
+        check_passes<4, Tiger::Padding::Tiger1> (sbox ());
+        check_passes<6, Tiger::Padding::Tiger1> (sbox ());
+        check_passes<8, Tiger::Padding::Tiger1> (sbox ());
+        check_passes<3, Tiger::Padding::Tiger2> (sbox ());
+        check_passes<4, Tiger::Padding::Tiger2> (sbox ());
+        check_passes<6, Tiger::Padding::Tiger2> (sbox ());
+        check_passes<8, Tiger::Padding::Tiger2> (sbox ());
+    }
+}
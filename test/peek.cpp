@@ -0,0 +1,44 @@
+
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test Peek") {
+    using namespace fmt::literals;
+
+    std::mt19937         rng (14);
+    std::vector<uint8_t> src (300);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+
+    SUBCASE ("abc") {
+        Tiger::Generator gen (sbox ());
+        gen.Update ("ab", 2);
+        REQUIRE ("{}"_format (gen.Peek ()) == "{}"_format (Tiger::Hash ("ab", 2)));
+        gen.Update ("c", 1);
+        REQUIRE ("{}"_format (gen.Peek ()) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+        REQUIRE (! gen.IsFinalized ());
+        REQUIRE ("{}"_format (gen.Finalize ()) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+        REQUIRE ("{}"_format (gen.Peek ()) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+    }
+    SUBCASE ("Every prefix") {
+        Tiger::Generator                                 gen (sbox (), 4, true);
+        Tiger::BasicGenerator<4, Tiger::Padding::Tiger2> basic (sbox ());
+        for (size_t i = 0; i < src.size (); ++i) {
+            Tiger::Generator ref (sbox (), 4, true);
+            auto const       expected = ref.Update (src.data (), i).Finalize ();
+            REQUIRE (gen.Peek () == expected);
+            REQUIRE (basic.Peek () == expected);
+            gen.Update (src[i]);
+            basic.Update (src[i]);
+        }
+    }
+}
@@ -0,0 +1,35 @@
+
+#include <SBoxReplicas.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test SBoxReplicas") {
+    Tiger::SBoxReplicas replicas (sbox ());
+    REQUIRE (1 <= replicas.NodeCount ());
+
+    auto const &local = replicas.Local ();
+    REQUIRE (local == sbox ());
+    REQUIRE (&local != &sbox ());
+    REQUIRE (&replicas.Local () == &local);
+    REQUIRE (&replicas.Replica (Tiger::SBoxReplicas::MAX_NODES) == &replicas.Replica (0));
+    REQUIRE (replicas.Replica (replicas.NodeCount () - 1) == sbox ());
+
+    std::vector<const Tiger::sbox_t *> seen (4);
+    std::vector<std::thread>           threads;
+    for (size_t i = 0; i < seen.size (); ++i) {
+        threads.emplace_back ([&replicas, &seen, i] () { seen[i] = &replicas.Local (); });
+    }
+    for (auto &t : threads) {
+        t.join ();
+    }
+    for (auto p : seen) {
+        REQUIRE (*p == sbox ());
+    }
+}
@@ -0,0 +1,23 @@
+
+#include <Tiger.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+
+TEST_CASE ("Test SBox") {
+    SUBCASE ("Precomputed default") {
+        Tiger::sbox_t sbox;
+        Tiger::InitializeSBox (sbox);
+
+        REQUIRE (sbox == Tiger::DefaultSBox ());
+    }
+    SUBCASE ("Known entries") {
+        auto const &sbox = Tiger::DefaultSBox ();
+
+        REQUIRE (sbox[0 * 256 + 0] == 0x02AAB17CF7E90C5EuLL);
+        REQUIRE (sbox[1 * 256 + 0] == 0xE6A6BE5A05A12138uLL);
+        REQUIRE (sbox[2 * 256 + 0] == 0xF49FCC2FF1DAF39BuLL);
+        REQUIRE (sbox[3 * 256 + 255] == 0xC3A0396F7363A51FuLL);
+    }
+}
@@ -0,0 +1,87 @@
+
+#include <SBoxCache.hpp>
+#include <Tiger.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+    const char *CACHE_DIRECTORY = "test-tiger-sboxcache.tmp";
+
+    std::vector<std::string> make_seeds (size_t count) {
+        std::vector<std::string> result;
+        for (size_t i = 0; i < count; ++i) {
+            result.emplace_back ("tenant-" + std::to_string (i));
+        }
+        return result;
+    }
+
+    std::vector<Tiger::ByteView> make_views (const std::vector<std::string> &seeds) {
+        std::vector<Tiger::ByteView> result;
+        for (auto const &s : seeds) {
+            result.emplace_back (Tiger::ByteView {s.data (), s.size ()});
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE ("Test BuildSBoxes") {
+    auto const seeds = make_seeds (5);
+    auto const views = make_views (seeds);
+
+    for (size_t cntThread : {1, 3}) {
+        std::vector<Tiger::sbox_t> result (seeds.size ());
+        Tiger::BuildSBoxes (result.data (), views.data (), views.size (), 2, cntThread);
+        for (size_t i = 0; i < seeds.size (); ++i) {
+            Tiger::sbox_t expected;
+            Tiger::InitializeSBox (expected, seeds[i].data (), seeds[i].size (), 2);
+            REQUIRE (result[i] == expected);
+        }
+    }
+}
+
+TEST_CASE ("Test SBoxCache") {
+    auto const seeds = make_seeds (3);
+    auto const views = make_views (seeds);
+
+    std::vector<Tiger::sbox_t> expected (seeds.size ());
+    for (size_t i = 0; i < seeds.size (); ++i) {
+        Tiger::InitializeSBox (expected[i], seeds[i].data (), seeds[i].size (), 1);
+    }
+    {
+        Tiger::SBoxCache cache (CACHE_DIRECTORY);
+
+        SUBCASE ("One by one") {
+            auto const &sbox = cache.Get (seeds[0].data (), seeds[0].size (), 1);
+            REQUIRE (sbox == expected[0]);
+            REQUIRE (&cache.Get (seeds[0].data (), seeds[0].size (), 1) == &sbox);
+
+            // Loaded from the file by another instance.
+            Tiger::SBoxCache other (CACHE_DIRECTORY);
+            REQUIRE (other.Get (seeds[0].data (), seeds[0].size (), 1) == expected[0]);
+        }
+        SUBCASE ("Batch") {
+            std::vector<const Tiger::sbox_t *> result (seeds.size ());
+            cache.Get (result.data (), views.data (), views.size (), 1, 2);
+            for (size_t i = 0; i < seeds.size (); ++i) {
+                REQUIRE (*result[i] == expected[i]);
+            }
+        }
+        SUBCASE ("Corrupted file") {
+            auto const path = cache.PathOf (seeds[1].data (), seeds[1].size (), 1);
+            auto       fp   = std::fopen (path.c_str (), "wb");
+            REQUIRE (fp != nullptr);
+            std::fputs ("garbage", fp);
+            std::fclose (fp);
+            REQUIRE (cache.Get (seeds[1].data (), seeds[1].size (), 1) == expected[1]);
+        }
+        for (auto const &s : seeds) {
+            std::remove (cache.PathOf (s.data (), s.size (), 1).c_str ());
+        }
+    }
+    std::remove (CACHE_DIRECTORY);
+}
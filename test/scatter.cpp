@@ -0,0 +1,41 @@
+
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test scattered UpdateV") {
+    std::mt19937         rng (17);
+    std::vector<uint8_t> src (5000);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+    Tiger::Generator ref (sbox ());
+    auto const       expected = ref.Update (src.data (), src.size ()).Finalize ();
+
+    SUBCASE ("Segments") {
+        for (size_t maxSegment : {1, 7, 63, 64, 65, 1500}) {
+            std::vector<Tiger::ByteView> segments;
+            for (size_t off = 0; off < src.size ();) {
+                size_t n = rng () % (maxSegment + 1);
+                n        = std::min (n, src.size () - off);
+                segments.emplace_back (Tiger::ByteView {src.data () + off, n});
+                off += n;
+            }
+            Tiger::Generator         gen (sbox ());
+            Tiger::BasicGenerator<3> basic (sbox ());
+            REQUIRE (gen.UpdateV (segments.data (), segments.size ()).Finalize () == expected);
+            REQUIRE (basic.UpdateV (segments.data (), segments.size ()).Finalize () == expected);
+        }
+    }
+    SUBCASE ("No segments") {
+        Tiger::Generator gen (sbox ());
+        Tiger::Generator empty (sbox ());
+        REQUIRE (gen.UpdateV (nullptr, 0).Update (nullptr, 0).Finalize () == empty.Finalize ());
+    }
+}
@@ -0,0 +1,86 @@
+
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test SaveState/RestoreState") {
+    using namespace fmt::literals;
+
+    std::mt19937         rng (9);
+    std::vector<uint8_t> src (1000);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+
+    SUBCASE ("Resume at any offset") {
+        for (size_t passes : {3, 4, 5}) {
+            for (bool isTiger2 : {false, true}) {
+                Tiger::Generator ref (sbox (), passes, isTiger2);
+                auto const       expected = ref.Update (src.data (), src.size ()).Finalize ();
+                for (size_t off = 0; off < src.size (); off += 37) {
+                    Tiger::Generator gen (sbox (), passes, isTiger2);
+                    auto const       saved = gen.Update (src.data (), off).SaveState ();
+
+                    // Restores into the generator with the different configuration.
+                    Tiger::Generator resumed (sbox ());
+                    REQUIRE (resumed.RestoreState (saved));
+                    REQUIRE (resumed.IsTiger2 () == isTiger2);
+                    resumed.Update (src.data () + off, src.size () - off);
+                    REQUIRE (resumed.Finalize () == expected);
+                }
+            }
+        }
+    }
+    SUBCASE ("Finalized state") {
+        Tiger::Generator gen (sbox ());
+        gen.Update ("abc", 3).Finalize ();
+        Tiger::Generator resumed (sbox ());
+        REQUIRE (resumed.RestoreState (gen.SaveState ()));
+        REQUIRE (resumed.IsFinalized ());
+        REQUIRE ("{}"_format (resumed.Finalize ()) == "2AAB1484E8C158F2BFB8C5FF41B57A525129131C957B5F93");
+    }
+    SUBCASE ("Stable encoding") {
+        Tiger::Generator gen (sbox (), 4, true);
+        auto const       saved = gen.Update ("abc", 3).SaveState ();
+        REQUIRE (saved[0] == 'T');
+        REQUIRE (saved[4] == 1);
+        REQUIRE (saved[5] == 2);
+        REQUIRE (saved[6] == 4);
+        REQUIRE (saved[7] == 0);
+        REQUIRE (saved[16] == 3);
+        REQUIRE (saved[48] == 'a');
+        REQUIRE (saved[50] == 'c');
+        REQUIRE (saved[51] == 0);
+    }
+    SUBCASE ("Rejects the mismatched SBox") {
+        Tiger::sbox_t other;
+        Tiger::InitializeSBox (other, "seed", 4, 1);
+        Tiger::Generator gen (other);
+        auto const       saved = gen.Update ("abc", 3).SaveState ();
+
+        Tiger::Generator target (sbox ());
+        target.Update ("xyz", 3);
+        REQUIRE (! target.RestoreState (saved));
+        Tiger::Generator ref (sbox ());
+        REQUIRE (target.Finalize () == ref.Update ("xyz", 3).Finalize ());
+    }
+    SUBCASE ("Rejects malformed states") {
+        Tiger::Generator gen (sbox ());
+        auto             saved = gen.SaveState ();
+        saved[4]               = 99;
+        REQUIRE (! gen.RestoreState (saved));
+        saved    = gen.SaveState ();
+        saved[0] = 'X';
+        REQUIRE (! gen.RestoreState (saved));
+        saved    = gen.SaveState ();
+        saved[6] = 1;
+        REQUIRE (! gen.RestoreState (saved));
+    }
+}
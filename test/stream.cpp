@@ -0,0 +1,90 @@
+
+#include <StreamHasher.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <system_error>
+#include <vector>
+
+TEST_CASE_FIXTURE (TigerFixture, "Test StreamHasher") {
+    std::mt19937         rng (19);
+    std::vector<uint8_t> src (300000 + 13);
+    for (auto &v : src) {
+        v = static_cast<uint8_t> (rng ());
+    }
+    Tiger::StreamHasherOptions options;
+    options.bufferSize = 4096 + 7;
+    options.cntBuffer  = 2;
+
+    // Reads the SRC in short (odd sized) reads.
+    auto reader = [&src] (size_t chunk) {
+        size_t off = 0;
+        return [&src, chunk, off] (uint8_t *buffer, size_t size) mutable -> ptrdiff_t {
+            size_t n = std::min ({size, chunk, src.size () - off});
+            std::memcpy (buffer, src.data () + off, n);
+            off += n;
+            return static_cast<ptrdiff_t> (n);
+        };
+    };
+
+    // The digests of the SRC by `Generator`, one per padding.
+    const Tiger::Padding paddings[] = {Tiger::Padding::Tiger1, Tiger::Padding::Tiger2};
+    Tiger::digest_t      reference[2];
+    for (size_t i = 0; i < 2; ++i) {
+        Tiger::Generator gen (sbox (), Tiger::DEFAULT_PASSES, paddings[i] == Tiger::Padding::Tiger2);
+        reference[i] = gen.Update (src.data (), src.size ()).Finalize ();
+    }
+
+    SUBCASE ("Write") {
+        for (size_t i = 0; i < 2; ++i) {
+            options.padding = paddings[i];
+            Tiger::StreamHasher hasher (options);
+            for (size_t off = 0, n = 1; off < src.size (); off += n, n = n * 3 + 1) {
+                hasher.Write (src.data () + off, std::min (n, src.size () - off));
+            }
+            REQUIRE (hasher.Count () == src.size ());
+            auto const result = hasher.Finalize ().get ();
+            REQUIRE (result.digest == reference[i]);
+            REQUIRE (result.size == src.size ());
+            REQUIRE (hasher.Finalize ().get ().digest == reference[i]);
+        }
+    }
+    SUBCASE ("Pump") {
+        for (size_t i = 0; i < 2; ++i) {
+            options.padding = paddings[i];
+            Tiger::StreamHasher hasher (options);
+            REQUIRE (hasher.Pump (reader (1000 + 3)) == 0);
+            REQUIRE (hasher.Finalize ().get ().digest == reference[i]);
+        }
+    }
+    SUBCASE ("HashStream") {
+        for (size_t i = 0; i < 2; ++i) {
+            options.padding = paddings[i];
+            auto const result = Tiger::HashStream (reader (65536), options).get ();
+            REQUIRE (result.digest == reference[i]);
+            REQUIRE (result.size == src.size ());
+        }
+    }
+    SUBCASE ("Empty stream") {
+        using namespace fmt::literals;
+        Tiger::StreamHasher hasher;
+        REQUIRE ("{}"_format (hasher.Finalize ().get ().digest) == "3293AC630C13F0245F92BBB1766E16167A4E58492DDE73F3");
+    }
+    SUBCASE ("Read error") {
+        auto failing = [] (uint8_t *, size_t) -> ptrdiff_t { return -EIO; };
+        Tiger::StreamHasher hasher (options);
+        REQUIRE (hasher.Pump (failing) == EIO);
+
+        auto result = Tiger::HashStream (failing, options);
+        CHECK_THROWS_AS (result.get (), std::system_error);
+    }
+}
@@ -0,0 +1,106 @@
+
+#include <TableHash.hpp>
+#include <Tiger.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    const Tiger::state_t KEY {{0x0123456789ABCDEFuLL, 0xFEDCBA9876543210uLL, 0xF096A5B4C3B2E187uLL}};
+
+    size_t popcount (uint64_t v) {
+        size_t result = 0;
+        for (; v != 0; v &= v - 1) {
+            ++result;
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE_FIXTURE (TigerFixture, "Test TableHash") {
+    using namespace fmt::literals;
+
+    Tiger::TableHash hash (KEY, sbox ());
+
+    SUBCASE ("Known answers") {
+        // Pins the definition (the same on the big-endian hosts).
+        std::string src ("The quick brown fox jumps over the lazy dog");
+        std::string longer (200, 'a');
+        REQUIRE ("{:016X}"_format (hash ("", 0)) == "885614F2DCA9C423");
+        REQUIRE ("{:016X}"_format (hash (src.data (), src.size ())) == "8E69A200F63F04AC");
+        REQUIRE ("{:016X}"_format (hash (longer.data (), longer.size ())) == "91321C20744EABE3");
+    }
+    SUBCASE ("Integers") {
+        for (uint64_t v : {0uLL, 1uLL, 0x0102030405060708uLL, ~0uLL}) {
+            uint8_t bytes[8];
+            for (size_t i = 0; i < 8; ++i) {
+                bytes[i] = static_cast<uint8_t> (v >> (8 * i));
+            }
+            REQUIRE (hash (v) == hash (bytes, sizeof (bytes)));
+        }
+    }
+    SUBCASE ("Lengths") {
+        // The zero-filled tails never collide.
+        std::vector<uint8_t> zeros (300, 0);
+        std::set<uint64_t>   seen;
+        for (size_t n = 0; n <= zeros.size (); ++n) {
+            REQUIRE (seen.insert (hash (zeros.data (), n)).second);
+        }
+    }
+    SUBCASE ("Keys") {
+        auto key = KEY;
+        key[1] ^= 1;
+        Tiger::TableHash other (key, sbox ());
+        REQUIRE (hash ("abc", 3) != other ("abc", 3));
+        REQUIRE (Tiger::TableHash {} ("abc", 3) == Tiger::TableHash (Tiger::TableHash::ProcessKey ()) ("abc", 3));
+    }
+    SUBCASE ("Avalanche") {
+        // Flipping an input bit flips about half of the output bits.
+        std::mt19937_64 rng (24);
+        size_t          total = 0;
+        size_t          count = 0;
+        for (size_t i = 0; i < 64; ++i) {
+            auto const v = rng ();
+            auto const h = hash (v);
+            for (size_t b = 0; b < 64; ++b) {
+                total += popcount (h ^ hash (v ^ (1uLL << b)));
+                ++count;
+            }
+        }
+        auto const average = static_cast<double> (total) / count;
+        REQUIRE (30.0 < average);
+        REQUIRE (average < 34.0);
+    }
+    SUBCASE ("Buckets") {
+        // The sequential integers spread over the low bits evenly.
+        std::vector<size_t> buckets (1024, 0);
+        for (uint64_t v = 0; v < 64 * buckets.size (); ++v) {
+            ++buckets[hash (v) % buckets.size ()];
+        }
+        for (auto n : buckets) {
+            REQUIRE (24 < n);
+            REQUIRE (n < 112);
+        }
+    }
+    SUBCASE ("TableHasher") {
+        std::unordered_map<std::string, int, Tiger::TableHasher> map;
+        for (int i = 0; i < 1000; ++i) {
+            map["key-{}"_format (i)] = i;
+        }
+        REQUIRE (map.size () == 1000);
+        REQUIRE (map.at ("key-123") == 123);
+
+        Tiger::TableHasher hasher;
+        REQUIRE (hasher (std::string ("abc")) == hasher (Tiger::ByteView {"abc", 3}));
+        REQUIRE (hasher (42) == hasher (uint64_t {42}));
+    }
+}
@@ -0,0 +1,99 @@
+#
+# Round-trips `tigersum` and `tigersum -c`.
+#
+#   cmake -DTIGERSUM=<path to tigersum> -DWORK_DIR=<scratch directory> -P tigersum-roundtrip.cmake
+#
+
+cmake_minimum_required (VERSION 3.14)
+
+foreach (var_ TIGERSUM WORK_DIR)
+    if (NOT DEFINED ${var_})
+        message (FATAL_ERROR "${var_} is not set")
+    endif ()
+endforeach ()
+
+file (REMOVE_RECURSE ${WORK_DIR})
+file (MAKE_DIRECTORY ${WORK_DIR})
+
+# Runs tigersum and checks the exit status (stdout goes to ${out_var_}).
+function (tigersum expected_ out_var_)
+    execute_process (COMMAND ${TIGERSUM} ${ARGN}
+                     WORKING_DIRECTORY ${WORK_DIR}
+                     RESULT_VARIABLE rc_
+                     OUTPUT_VARIABLE out_
+                     ERROR_VARIABLE err_)
+    if (NOT rc_ EQUAL expected_)
+        message (FATAL_ERROR "tigersum ${ARGN}: exited with ${rc_} (expected ${expected_})\n${out_}${err_}")
+    endif ()
+    set (${out_var_} "${out_}" PARENT_SCOPE)
+endfunction ()
+
+function (expect_equal actual_ expected_ what_)
+    if (NOT "${actual_}" STREQUAL "${expected_}")
+        message (FATAL_ERROR "${what_}:\n--- actual\n${actual_}--- expected\n${expected_}")
+    endif ()
+endfunction ()
+
+# Enough files (of the various sizes) to have many of them in flight.
+set (files_)
+foreach (i_ RANGE 1 40)
+    string (REPEAT "${i_} bottles of beer on the wall\n" ${i_}${i_} contents_)
+    file (WRITE ${WORK_DIR}/file-${i_}.txt "${contents_}")
+    list (APPEND files_ file-${i_}.txt)
+endforeach ()
+file (WRITE ${WORK_DIR}/empty.txt "")
+list (APPEND files_ empty.txt)
+
+# The known answers.
+tigersum (0 out_ empty.txt)
+expect_equal ("${out_}" "3293ac630c13f0245f92bbb1766e16167a4e58492dde73f3  empty.txt\n" "Tiger of the empty file")
+tigersum (0 out_ -t empty.txt)
+expect_equal ("${out_}" "LWPNACQDBZRYXW3VHJVCJ64QBZNGHOHHHZWCLNQ  empty.txt\n" "TTH of the empty file")
+
+foreach (options_ "" "-2" "-t" "--tag" "--tag;-t" "-j;1")
+    # The digests are printed in the order of the arguments.
+    tigersum (0 sums_ ${options_} ${files_})
+    string (REGEX MATCHALL "[^\n]+" lines_ "${sums_}")
+    set (order_)
+    foreach (line_ IN LISTS lines_)
+        string (REGEX REPLACE "^[0-9A-Za-z]+  " "" path_ "${line_}")
+        string (REGEX REPLACE "^[A-Z0-9]+ \\((.*)\\) = [0-9A-Za-z]+$" "\\1" path_ "${path_}")
+        list (APPEND order_ ${path_})
+    endforeach ()
+    expect_equal ("${order_}" "${files_}" "Order of the output (${options_})")
+    file (WRITE ${WORK_DIR}/sums.txt "${sums_}")
+
+    # Everything verifies (with the algorithm of the GNU style lines).
+    set (check_options_ ${options_})
+    list (REMOVE_ITEM check_options_ "--tag")
+    tigersum (0 out_ -c ${check_options_} sums.txt)
+    set (expected_)
+    foreach (file_ IN LISTS files_)
+        string (APPEND expected_ "${file_}: OK\n")
+    endforeach ()
+    expect_equal ("${out_}" "${expected_}" "Check (${options_})")
+    tigersum (0 out_ -c -q ${check_options_} sums.txt)
+    expect_equal ("${out_}" "" "Quiet check (${options_})")
+endforeach ()
+
+# A modified file fails the check.
+tigersum (0 sums_ ${files_})
+file (WRITE ${WORK_DIR}/sums.txt "${sums_}")
+file (APPEND ${WORK_DIR}/file-7.txt "!")
+tigersum (1 out_ -c -q sums.txt)
+expect_equal ("${out_}" "file-7.txt: FAILED\n" "Check of the modified file")
+
+# The lists without a single check line fail.
+file (WRITE ${WORK_DIR}/empty-list.txt "")
+tigersum (1 out_ -c empty-list.txt)
+file (WRITE ${WORK_DIR}/garbage-list.txt "garbage\n")
+tigersum (1 out_ -c garbage-list.txt)
+tigersum (1 out_ -c missing-list.txt)
+
+# The malformed options are rejected.
+foreach (jobs_ "foo" "4x" "-1" "")
+    tigersum (2 out_ -j "${jobs_}" empty.txt)
+endforeach ()
+tigersum (2 out_ empty.txt -j)
+
+file (REMOVE_RECURSE ${WORK_DIR})
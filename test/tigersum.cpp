@@ -0,0 +1,248 @@
+
+#include <CheckList.hpp>
+#include <Checksum.hpp>
+#include <Scheduler.hpp>
+#include <Tiger.hpp>
+#include <TreeHasher.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string DIGEST_HEX    = "3293ac630c13f0245f92bbb1766e16167a4e58492dde73f3";
+    const std::string DIGEST_BASE32 = "GKJ2YYYMCPYCIX4SXOYXM3QWCZ5E4WCJFXPHH4Y";  ///< The same digest in base32
+
+    /// A small chunk (4 leaves) to split the test files into many chunks.
+    const uint64_t SMALL_CHUNK = 4 * Tiger::TreeHasher::LEAF_SIZE;
+
+    /** Waits for the jobs completed on the workers.  */
+    class Latch {
+        std::mutex              mutex_;
+        std::condition_variable cond_;
+        size_t                  count_;
+
+    public:
+        explicit Latch (size_t count) : count_ {count} { /* NO-OP */
+        }
+
+        void CountDown () {
+            std::lock_guard<std::mutex> lock (mutex_);
+            if (--count_ == 0) {
+                cond_.notify_all ();
+            }
+        }
+
+        void Wait () {
+            std::unique_lock<std::mutex> lock (mutex_);
+            cond_.wait (lock, [this] () { return count_ == 0; });
+        }
+    };
+
+    /** A temporary file removed on exit.  */
+    class TemporaryFile {
+        std::string path_;
+
+    public:
+        TemporaryFile (const std::string &path, const std::vector<uint8_t> &contents) : path_ {path} {
+            auto fp = std::fopen (path_.c_str (), "wb");
+            REQUIRE (fp != nullptr);
+            if (! contents.empty ()) {
+                std::fwrite (contents.data (), 1, contents.size (), fp);
+            }
+            std::fclose (fp);
+        }
+        ~TemporaryFile () { std::remove (path_.c_str ()); }
+
+        const std::string &Path () const { return path_; }
+    };
+
+    std::vector<uint8_t> random_bytes (size_t size, uint32_t seed) {
+        std::mt19937         rng (seed);
+        std::vector<uint8_t> result (size);
+        for (auto &v : result) {
+            v = static_cast<uint8_t> (rng ());
+        }
+        return result;
+    }
+}  // namespace
+
+TEST_CASE ("Test tigersum check lines") {
+    using TigerSum::Algorithm;
+
+    TigerSum::Entry entry;
+    SUBCASE ("GNU style") {
+        REQUIRE (TigerSum::ParseCheckLine (DIGEST_HEX + "  some file.txt", Algorithm::Tiger2, entry));
+        REQUIRE (entry.path == "some file.txt");
+        REQUIRE (entry.algorithm == Algorithm::Tiger2);
+        REQUIRE (entry.expected == DIGEST_HEX);
+
+        REQUIRE (TigerSum::ParseCheckLine (DIGEST_BASE32 + " *binary.bin", Algorithm::TTH, entry));
+        REQUIRE (entry.path == "binary.bin");
+        REQUIRE (entry.algorithm == Algorithm::TTH);
+        REQUIRE (entry.expected == DIGEST_BASE32);
+    }
+    SUBCASE ("BSD style") {
+        REQUIRE (TigerSum::ParseCheckLine ("TTH (a (b) = c) = " + DIGEST_BASE32, Algorithm::Tiger, entry));
+        REQUIRE (entry.path == "a (b) = c");
+        REQUIRE (entry.algorithm == Algorithm::TTH);
+        REQUIRE (entry.expected == DIGEST_BASE32);
+
+        REQUIRE (TigerSum::ParseCheckLine ("TIGER2 (x) = " + DIGEST_HEX, Algorithm::Tiger, entry));
+        REQUIRE (entry.algorithm == Algorithm::Tiger2);
+    }
+    SUBCASE ("Upper case digests") {
+        std::string upper {"3293AC630C13F0245F92BBB1766E16167A4E58492DDE73F3"};
+        REQUIRE (TigerSum::ParseCheckLine (upper + "  x", Algorithm::Tiger, entry));
+        REQUIRE (entry.expected == DIGEST_HEX);
+        REQUIRE (TigerSum::ParseCheckLine ("TIGER (x) = " + upper, Algorithm::Tiger, entry));
+        REQUIRE (entry.expected == DIGEST_HEX);
+
+        std::string lower {"gkj2yyymcpycix4sxoyxm3qwcz5e4wcjfxphh4y"};
+        REQUIRE (TigerSum::ParseCheckLine (lower + "  x", Algorithm::TTH, entry));
+        REQUIRE (entry.expected == DIGEST_BASE32);
+    }
+    SUBCASE ("TTH digests") {
+        Tiger::digest_t digest;
+        for (size_t i = 0; i < digest.size (); ++i) {
+            digest[i] = static_cast<uint8_t> (std::stoul (DIGEST_HEX.substr (2 * i, 2), nullptr, 16));
+        }
+        REQUIRE (TigerSum::ToBase32 (digest) == DIGEST_BASE32);
+        REQUIRE (TigerSum::FormatDigest (Algorithm::TTH, digest) == DIGEST_BASE32);
+        REQUIRE (TigerSum::FormatDigest (Algorithm::Tiger2, digest) == DIGEST_HEX);
+
+        // Only in base32.
+        REQUIRE (! TigerSum::ParseCheckLine (DIGEST_HEX + "  x", Algorithm::TTH, entry));
+        REQUIRE (! TigerSum::ParseCheckLine ("TTH (x) = " + DIGEST_HEX, Algorithm::Tiger, entry));
+        REQUIRE (! TigerSum::ParseCheckLine ("TTH (x) = " + DIGEST_BASE32.substr (1) + "1", Algorithm::Tiger, entry));
+        REQUIRE (! TigerSum::ParseCheckLine (DIGEST_BASE32 + "  x", Algorithm::Tiger, entry));
+    }
+    SUBCASE ("CRLF") {
+        REQUIRE (TigerSum::ParseCheckLine (DIGEST_HEX + "  dos.txt\r", Algorithm::Tiger, entry));
+        REQUIRE (entry.path == "dos.txt");
+        REQUIRE (TigerSum::ParseCheckLine ("TIGER (dos.txt) = " + DIGEST_HEX + "\r", Algorithm::Tiger, entry));
+        REQUIRE (entry.path == "dos.txt");
+        REQUIRE (entry.expected == DIGEST_HEX);
+    }
+    SUBCASE ("Malformed") {
+        for (std::string line : {std::string {},
+                                 std::string {"garbage"},
+                                 DIGEST_HEX,
+                                 DIGEST_HEX + "  ",
+                                 DIGEST_HEX + " x",
+                                 DIGEST_HEX.substr (1) + "  x",
+                                 DIGEST_HEX.substr (1) + "g  x",
+                                 "MD5 (x) = " + DIGEST_HEX,
+                                 "TIGER (x) = " + DIGEST_HEX.substr (2),
+                                 "TIGER x = " + DIGEST_HEX}) {
+            REQUIRE (! TigerSum::ParseCheckLine (line, Algorithm::Tiger, entry));
+        }
+    }
+    SUBCASE ("Check list") {
+        std::istringstream in {DIGEST_HEX + "  a\r\n" +
+                               "\n" +
+                               "garbage\n" +
+                               "TTH (b) = " + DIGEST_BASE32 + "\n" +
+                               "\r\n" +
+                               DIGEST_HEX + " *c"};
+        std::vector<TigerSum::Entry> entries;
+        REQUIRE (TigerSum::ReadCheckList (in, Algorithm::Tiger, entries) == 1);
+        REQUIRE (entries.size () == 3);
+        REQUIRE (entries[0].path == "a");
+        REQUIRE (entries[1].path == "b");
+        REQUIRE (entries[1].algorithm == Algorithm::TTH);
+        REQUIRE (entries[2].path == "c");
+    }
+}
+
+TEST_CASE ("Test tigersum Scheduler") {
+    SUBCASE ("Nested submits") {
+        std::atomic<size_t> sum {0};
+        Latch               latch (100);
+        {
+            TigerSum::Scheduler scheduler (3);
+            REQUIRE (scheduler.Size () == 3);
+            for (size_t i = 0; i < 10; ++i) {
+                scheduler.Submit ([&scheduler, &sum, &latch, i] () {
+                    for (size_t k = 0; k < 10; ++k) {
+                        scheduler.Submit ([&sum, &latch, i, k] () {
+                            sum += 10 * i + k;
+                            latch.CountDown ();
+                        });
+                    }
+                });
+            }
+            latch.Wait ();
+        }
+        REQUIRE (sum == 99 * 100 / 2);
+    }
+}
+
+TEST_CASE_FIXTURE (TigerFixture, "Test tigersum HashJob") {
+    using TigerSum::Algorithm;
+
+    SUBCASE ("Merging the chunk roots") {
+        auto const src = random_bytes (7 * SMALL_CHUNK + 123, 21);
+
+        std::vector<Tiger::digest_t> roots;
+        for (size_t off = 0; off < src.size (); off += SMALL_CHUNK) {
+            Tiger::TreeHasher chunk (sbox ());
+            chunk.Update (src.data () + off, std::min<size_t> (SMALL_CHUNK, src.size () - off));
+            roots.emplace_back (chunk.Finalize ());
+        }
+        Tiger::TreeHasher tree (sbox ());
+        tree.Update (src.data (), src.size ());
+        REQUIRE (TigerSum::MergeChunkRoots (roots) == tree.Finalize ());
+    }
+    SUBCASE ("Files") {
+        // Spans the single chunk, the exact multiples and the ragged tails.
+        const std::vector<size_t> sizes {0, 1, SMALL_CHUNK, SMALL_CHUNK + 1, 2 * SMALL_CHUNK, 5 * SMALL_CHUNK + 1000, 16 * SMALL_CHUNK - 1};
+
+        std::vector<std::unique_ptr<TemporaryFile>> files;
+        std::vector<std::vector<uint8_t>>           contents;
+        for (size_t i = 0; i < sizes.size (); ++i) {
+            contents.emplace_back (random_bytes (sizes[i], static_cast<uint32_t> (i)));
+            files.emplace_back (new TemporaryFile ("test-tigersum-" + std::to_string (i) + ".tmp", contents.back ()));
+        }
+        for (auto algorithm : {Algorithm::Tiger, Algorithm::Tiger2, Algorithm::TTH}) {
+            std::vector<TigerSum::Job> jobs (files.size () + 1);
+            Latch                      latch (jobs.size ());
+            {
+                TigerSum::Scheduler scheduler (3);
+                for (size_t i = 0; i < jobs.size (); ++i) {
+                    jobs[i].path      = i < files.size () ? files[i]->Path () : "test-tigersum-missing.tmp";
+                    jobs[i].algorithm = algorithm;
+                    TigerSum::HashJob (
+                        scheduler, jobs[i], [&latch] (TigerSum::Job &) { latch.CountDown (); }, SMALL_CHUNK);
+                }
+                latch.Wait ();
+            }
+            for (size_t i = 0; i < files.size (); ++i) {
+                auto const &src = contents[i];
+                REQUIRE (jobs[i].error.empty ());
+                if (algorithm == Algorithm::TTH) {
+                    Tiger::TreeHasher tree (sbox ());
+                    tree.Update (src.data (), src.size ());
+                    REQUIRE (jobs[i].digest == tree.Finalize ());
+                }
+                else {
+                    Tiger::Generator gen (sbox (), Tiger::DEFAULT_PASSES, algorithm == Algorithm::Tiger2);
+                    REQUIRE (jobs[i].digest == gen.Update (src.data (), src.size ()).Finalize ());
+                }
+            }
+            REQUIRE (! jobs.back ().error.empty ());
+        }
+    }
+}
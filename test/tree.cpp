@@ -0,0 +1,92 @@
+
+#include <Tiger.hpp>
+#include <TreeHasher.hpp>
+
+#include "fixture.hpp"
+#include "to_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    /// Builds the whole tree level by level (the THEX definition).
+    std::vector<std::vector<Tiger::digest_t>> make_levels (const Tiger::TreeHasher &tree, const std::vector<uint8_t> &src) {
+        std::vector<Tiger::digest_t> level;
+        size_t                       off = 0;
+        do {
+            size_t n = std::min (src.size () - off, Tiger::TreeHasher::LEAF_SIZE);
+            level.emplace_back (tree.HashLeaf (src.data () + off, n));
+            off += n;
+        } while (off < src.size ());
+
+        std::vector<std::vector<Tiger::digest_t>> result {level};
+        while (1 < level.size ()) {
+            std::vector<Tiger::digest_t> upper;
+            for (size_t i = 0; i < level.size (); i += 2) {
+                upper.emplace_back (i + 1 < level.size () ? tree.HashNode (level[i], level[i + 1]) : level[i]);
+            }
+            level = upper;
+            result.emplace_back (level);
+        }
+        std::reverse (result.begin (), result.end ());
+        return result;
+    }
+}  // namespace
+
+TEST_CASE_FIXTURE (TigerFixture, "Test TreeHasher") {
+    using namespace fmt::literals;
+
+    SUBCASE ("(empty string)") {
+        Tiger::TreeHasher tree (sbox ());
+
+        REQUIRE ("{}"_format (tree.Finalize ()) == "5D9ED00A030E638BDB753A6A24FB900E5A63B8E73E6C25B6");
+    }
+    SUBCASE ("1024 \"A\"") {
+        Tiger::TreeHasher tree (sbox ());
+        std::string       src (1024, 'A');
+        tree.Update (src.c_str (), src.size ());
+
+        REQUIRE ("{}"_format (tree.Finalize ()) == "5FBD0E62AD016D596B77D1D28883B94FED78ECBAF4640914");
+    }
+    SUBCASE ("1025 \"A\"") {
+        Tiger::TreeHasher tree (sbox ());
+        std::string       src (1025, 'A');
+        tree.Update (src.c_str (), src.size ());
+
+        REQUIRE ("{}"_format (tree.Finalize ()) == "7E591C1CD8F2E6121FDBCD8071BA279626B771642D10A3DB");
+    }
+    SUBCASE ("Random splits and threads") {
+        std::mt19937 rng (7);
+        for (size_t size : {1u, 1023u, 2048u, 3u * 1024 + 5, 64u * 1024, 64u * 1024 + 1, 200u * 1024 + 77, 1u << 20}) {
+            std::vector<uint8_t> src (size);
+            for (auto &v : src) {
+                v = static_cast<uint8_t> (rng ());
+            }
+            for (size_t cntThread : {1u, 3u}) {
+                for (size_t level : {0u, 2u, 7u}) {
+                    Tiger::TreeHasher tree (sbox (), cntThread, level);
+                    size_t            off = 0;
+                    while (off < size) {
+                        size_t n = std::min<size_t> (size - off, rng () % (150 * 1024));
+                        tree.Update (src.data () + off, n);
+                        off += n;
+                    }
+                    auto const root     = tree.Finalize ();
+                    auto const expected = make_levels (tree, src);
+                    REQUIRE (root == expected[0][0]);
+
+                    auto const levels = tree.Levels ();
+                    REQUIRE (levels.size () == (level < expected.size () ? expected.size () - level : 1));
+                    for (size_t i = 0; i < levels.size (); ++i) {
+                        REQUIRE (levels[i] == expected[i]);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "CheckList.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace TigerSum {
+    namespace {
+        /// # of digits in a digest of the ALGORITHM.
+        size_t digits_of (Algorithm algorithm) {
+            return algorithm == Algorithm::TTH ? BASE32_DIGITS : HEX_DIGITS;
+        }
+
+        bool is_hex_digit (char ch) {
+            return std::isxdigit (static_cast<unsigned char> (ch)) != 0;
+        }
+
+        bool is_base32_digit (char ch) {
+            auto c = std::toupper (static_cast<unsigned char> (ch));
+            return ('A' <= c && c <= 'Z') || ('2' <= c && c <= '7');
+        }
+
+        /**
+         * Normalizes the digest of the ALGORITHM into the form of `FormatDigest`.
+         *
+         * @return false if the DIGEST is malformed
+         */
+        bool normalize (std::string &digest, Algorithm algorithm) {
+            auto const isTTH = algorithm == Algorithm::TTH;
+            if (digest.size () != digits_of (algorithm) || ! std::all_of (digest.begin (), digest.end (), isTTH ? is_base32_digit : is_hex_digit)) {
+                return false;
+            }
+            std::transform (digest.begin (), digest.end (), digest.begin (), [isTTH] (char ch) {
+                auto c = static_cast<unsigned char> (ch);
+                return static_cast<char> (isTTH ? std::toupper (c) : std::tolower (c));
+            });
+            return true;
+        }
+    }  // namespace
+
+    bool ParseCheckLine (std::string line, Algorithm algorithm, Entry &entry) {
+        if (! line.empty () && line.back () == '\r') {
+            line.pop_back ();
+        }
+        // BSD style: "ALGORITHM (FILE) = DIGEST"
+        auto lparen = line.find (" (");
+        auto rparen = line.rfind (") = ");
+        if (lparen != std::string::npos && rparen != std::string::npos && lparen < rparen) {
+            Algorithm a;
+            auto      digest = line.substr (rparen + 4);
+            if (ParseAlgorithm (line.substr (0, lparen), a) && normalize (digest, a)) {
+                entry = Entry {line.substr (lparen + 2, rparen - lparen - 2), a, digest};
+                return true;
+            }
+        }
+        // GNU style: "DIGEST  FILE" or "DIGEST *FILE"
+        auto const n = digits_of (algorithm);
+        if (n + 2 < line.size () && line[n] == ' ' && (line[n + 1] == ' ' || line[n + 1] == '*')) {
+            auto digest = line.substr (0, n);
+            if (normalize (digest, algorithm)) {
+                entry = Entry {line.substr (n + 2), algorithm, digest};
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t ReadCheckList (std::istream &in, Algorithm algorithm, std::vector<Entry> &entries) {
+        size_t      cntMalformed = 0;
+        std::string line;
+        while (std::getline (in, line)) {
+            Entry entry;
+            if (ParseCheckLine (line, algorithm, entry)) {
+                entries.emplace_back (std::move (entry));
+            }
+            else if (! line.empty () && line != "\r") {
+                ++cntMalformed;
+            }
+        }
+        return cntMalformed;
+    }
+}  // namespace TigerSum
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Parsing the check lists (`tigersum -c`).
+#pragma once
+
+#include "Checksum.hpp"
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace TigerSum {
+    /// # of hex digits in a digest.
+    const size_t HEX_DIGITS = 2 * sizeof (Tiger::digest_t);
+
+    /// # of base32 digits in a digest (without the padding).
+    const size_t BASE32_DIGITS = (8 * sizeof (Tiger::digest_t) + 4) / 5;
+
+    /** An input to be hashed (or verified).  */
+    struct Entry {
+        std::string path;
+        Algorithm   algorithm;
+        std::string expected;  ///< The expected digest as formatted by `FormatDigest` (when checking)
+    };
+
+    /**
+     * Parses a check line.
+     *
+     * Accepts the GNU style ("DIGEST  FILE" or "DIGEST *FILE") and the BSD
+     * style ("ALGORITHM (FILE) = DIGEST") lines, with or without the
+     * trailing CR.  The TTH digests are in base32, the others in hex
+     * (either in any case).
+     *
+     * @param line      The line (without the LF)
+     * @param algorithm The algorithm of the GNU style lines
+     * @param entry     Receives the entry
+     * @return false if the LINE is malformed
+     */
+    bool ParseCheckLine (std::string line, Algorithm algorithm, Entry &entry);
+
+    /**
+     * Collects the check lines.
+     *
+     * @param in        The check list
+     * @param algorithm The algorithm of the GNU style lines
+     * @param entries   Receives the entries (appended)
+     * @return # of malformed lines (the empty ones aside)
+     */
+    size_t ReadCheckList (std::istream &in, Algorithm algorithm, std::vector<Entry> &entries);
+}  // namespace TigerSum
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Checksum.hpp"
+
+#include <HashFile.hpp>
+#include <TreeHasher.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+namespace TigerSum {
+    namespace {
+        /// Read size (a task never holds more than this).
+        const size_t READ_SIZE = 1u << 20u;
+
+        std::string host_path (const std::string &path) {
+            return path == "-" ? "/dev/stdin" : path;
+        }
+
+        std::string error_message (int err) {
+            return std::generic_category ().message (err);
+        }
+
+        /**
+         * Feeds up to SIZE bytes from the current position of IN to the TREE.
+         *
+         * @return # of bytes fed
+         */
+        uint64_t feed (std::istream &in, Tiger::TreeHasher &tree, uint64_t size) {
+            std::vector<char> buffer (READ_SIZE);
+            uint64_t          result = 0;
+            while (result < size) {
+                in.read (buffer.data (), static_cast<std::streamsize> (std::min<uint64_t> (size - result, buffer.size ())));
+                auto n = static_cast<size_t> (in.gcount ());
+                if (n == 0) {
+                    break;
+                }
+                tree.Update (buffer.data (), n);
+                result += n;
+            }
+            return result;
+        }
+
+        /** TTH of a file hashed chunk by chunk.  */
+        struct TreeJob {
+            Job                         &job;
+            std::function<void (Job &)>  done;
+            uint64_t                     chunkSize;
+            std::vector<Tiger::digest_t> roots;
+            std::atomic<size_t>          remaining;
+            std::mutex                   mutex;
+
+            TreeJob (Job &j, std::function<void (Job &)> d, uint64_t chunkSize, size_t cntChunk)
+                    : job {j}
+                    , done {std::move (d)}
+                    , chunkSize {chunkSize}
+                    , roots (cntChunk)
+                    , remaining {cntChunk} {
+                /* NO-OP */
+            }
+
+            void Fail (const std::string &message) {
+                std::lock_guard<std::mutex> lock (mutex);
+                if (job.error.empty ()) {
+                    job.error = message;
+                }
+            }
+
+            void Finish () {
+                job.digest = MergeChunkRoots (std::move (roots));
+                done (job);
+            }
+        };
+
+        void hash_chunk (const std::shared_ptr<TreeJob> &tj, size_t index, uint64_t size) {
+            std::ifstream in (host_path (tj->job.path), std::ios::binary);
+            if (! in) {
+                tj->Fail (error_message (errno));
+            }
+            else {
+                Tiger::TreeHasher tree (Tiger::DefaultSBox (), 1, Tiger::TreeHasher::NO_LEVELS);
+                uint64_t const    offset = tj->chunkSize * index;
+                uint64_t const    n      = std::min<uint64_t> (tj->chunkSize, size - offset);
+                in.seekg (static_cast<std::streamoff> (offset));
+                if (! in || feed (in, tree, n) != n) {
+                    tj->Fail (in.bad () ? "read error" : "unexpected end of file");
+                }
+                tj->roots[index] = tree.Finalize ();
+            }
+            if (tj->remaining.fetch_sub (1, std::memory_order_acq_rel) == 1) {
+                tj->Finish ();
+            }
+        }
+
+        void hash_tree (Scheduler &scheduler, Job &job, std::function<void (Job &)> done, uint64_t chunkSize) {
+            std::ifstream in (host_path (job.path), std::ios::binary);
+            if (! in) {
+                job.error = error_message (errno);
+                done (job);
+                return;
+            }
+            in.seekg (0, std::ios::end);
+            auto const end = static_cast<std::streamoff> (in.tellg ());
+            in.clear ();
+            if (end < 0 || static_cast<uint64_t> (end) <= chunkSize) {
+                // Not seekable (a pipe) or a single chunk.
+                if (0 <= end) {
+                    in.seekg (0, std::ios::beg);
+                }
+                Tiger::TreeHasher tree (Tiger::DefaultSBox (), 1, Tiger::TreeHasher::NO_LEVELS);
+                feed (in, tree, ~static_cast<uint64_t> (0));
+                if (in.bad ()) {
+                    job.error = "read error";
+                }
+                job.digest = tree.Finalize ();
+                done (job);
+                return;
+            }
+            auto const size     = static_cast<uint64_t> (end);
+            auto const cntChunk = static_cast<size_t> ((size + chunkSize - 1) / chunkSize);
+            auto       tj       = std::make_shared<TreeJob> (job, std::move (done), chunkSize, cntChunk);
+            // Queued in the reverse order: The owner runs the first chunk next (LIFO),
+            // the thieves take the others from the front.
+            for (size_t i = cntChunk; 0 < i; --i) {
+                scheduler.Submit ([tj, i, size] () { hash_chunk (tj, i - 1, size); });
+            }
+        }
+
+        void hash_file (Job &job, std::function<void (Job &)> done) {
+            Tiger::HashFileOptions options;
+            options.padding = job.algorithm == Algorithm::Tiger2 ? Tiger::Padding::Tiger2 : Tiger::Padding::Tiger1;
+            try {
+                job.digest = Tiger::HashFile (host_path (job.path), options).digest;
+            }
+            catch (const std::system_error &e) {
+                job.error = e.code ().message ();
+            }
+            done (job);
+        }
+    }  // namespace
+
+    const char *AlgorithmName (Algorithm algorithm) {
+        switch (algorithm) {
+        case Algorithm::Tiger: return "TIGER";
+        case Algorithm::Tiger2: return "TIGER2";
+        case Algorithm::TTH: return "TTH";
+        }
+        return "";
+    }
+
+    bool ParseAlgorithm (const std::string &name, Algorithm &algorithm) {
+        for (auto a : {Algorithm::Tiger, Algorithm::Tiger2, Algorithm::TTH}) {
+            if (name == AlgorithmName (a)) {
+                algorithm = a;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string ToHex (const Tiger::digest_t &digest) {
+        static const char digits[] = "0123456789abcdef";
+
+        std::string result;
+        result.reserve (2 * digest.size ());
+        for (auto v : digest) {
+            result += digits[v >> 4u];
+            result += digits[v & 0x0Fu];
+        }
+        return result;
+    }
+
+    std::string ToBase32 (const Tiger::digest_t &digest) {
+        static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+
+        std::string result;
+        result.reserve ((8 * digest.size () + 4) / 5);
+        uint32_t bits  = 0;
+        uint32_t nbits = 0;
+        for (auto v : digest) {
+            bits = (bits << 8u) | v;
+            nbits += 8;
+            while (5 <= nbits) {
+                nbits -= 5;
+                result += digits[(bits >> nbits) & 0x1Fu];
+            }
+        }
+        if (0 < nbits) {
+            result += digits[(bits << (5 - nbits)) & 0x1Fu];
+        }
+        return result;
+    }
+
+    std::string FormatDigest (Algorithm algorithm, const Tiger::digest_t &digest) {
+        return algorithm == Algorithm::TTH ? ToBase32 (digest) : ToHex (digest);
+    }
+
+    Tiger::digest_t MergeChunkRoots (std::vector<Tiger::digest_t> roots) {
+        Tiger::TreeHasher tree (Tiger::DefaultSBox (), 1, Tiger::TreeHasher::NO_LEVELS);
+        while (1 < roots.size ()) {
+            std::vector<Tiger::digest_t> upper;
+            for (size_t i = 0; i + 1 < roots.size (); i += 2) {
+                upper.emplace_back (tree.HashNode (roots[i], roots[i + 1]));
+            }
+            if (roots.size () % 2 != 0) {
+                upper.emplace_back (roots.back ());
+            }
+            roots.swap (upper);
+        }
+        return roots[0];
+    }
+
+    void HashJob (Scheduler &scheduler, Job &job, std::function<void (Job &)> done, uint64_t chunkSize) {
+        auto *j = &job;
+        if (job.algorithm == Algorithm::TTH) {
+            scheduler.Submit ([&scheduler, j, done, chunkSize] () { hash_tree (scheduler, *j, done, chunkSize); });
+        }
+        else {
+            scheduler.Submit ([j, done] () { hash_file (*j, done); });
+        }
+    }
+}  // namespace TigerSum
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Computing checksums of files on the scheduler.
+#pragma once
+
+#include "Scheduler.hpp"
+
+#include <Tiger.hpp>
+
+#include <TreeHasher.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace TigerSum {
+    /// Bytes in a TTH chunk (64 MiB, a complete subtree of the height 16).
+    const uint64_t DEFAULT_CHUNK_SIZE = (static_cast<uint64_t> (1) << 16u) * Tiger::TreeHasher::LEAF_SIZE;
+
+    /** Supported checksums.  */
+    enum class Algorithm {
+        Tiger,   ///< Tiger192
+        Tiger2,  ///< Tiger192 with the Tiger2 padding
+        TTH,     ///< Tiger Tree Hash (THEX)
+    };
+
+    /**
+     * Retrieves the name of the algorithm (as in the BSD style lines).
+     *
+     * @param algorithm The algorithm
+     * @return The name
+     */
+    const char *AlgorithmName (Algorithm algorithm);
+
+    /**
+     * Looks up the algorithm by the name.
+     *
+     * @param name      The name
+     * @param algorithm Receives the algorithm
+     * @return false if NAME is unknown
+     */
+    bool ParseAlgorithm (const std::string &name, Algorithm &algorithm);
+
+    /**
+     * Formats the digest in the lower case hex.
+     *
+     * @param digest The digest
+     * @return Formatted digest
+     */
+    std::string ToHex (const Tiger::digest_t &digest);
+
+    /**
+     * Formats the digest in the RFC 4648 base32 (upper case, without the padding).
+     *
+     * @param digest The digest
+     * @return Formatted digest
+     */
+    std::string ToBase32 (const Tiger::digest_t &digest);
+
+    /**
+     * Formats the digest as printed for the ALGORITHM.
+     *
+     * TTH roots are exchanged in base32 (as in `urn:tree:tiger:`), the
+     * others in hex.
+     *
+     * @param algorithm The algorithm
+     * @param digest    The digest
+     * @return `ToBase32 (digest)` for TTH, `ToHex (digest)` otherwise
+     */
+    std::string FormatDigest (Algorithm algorithm, const Tiger::digest_t &digest);
+
+    /**
+     * Merges the roots of the chunks into the TTH of the whole file.
+     *
+     * The chunks are the complete subtrees of the same height (but the
+     * last one), so their roots are the upper levels of the tree: The
+     * pairs are hashed as the nodes and an odd one out is promoted as is.
+     *
+     * @param roots The roots of the chunks (in order, at least one)
+     * @return The TTH
+     */
+    Tiger::digest_t MergeChunkRoots (std::vector<Tiger::digest_t> roots);
+
+    /** A file to be hashed.  */
+    struct Job {
+        std::string     path;
+        Algorithm       algorithm = Algorithm::Tiger;
+        std::string     expected;  ///< The expected digest as formatted by `FormatDigest` (when checking)
+        Tiger::digest_t digest;
+        std::string     error;  ///< The reason of the failure (empty on success)
+        bool            done = false;
+    };
+
+    /**
+     * Hashes a file on the scheduler.
+     *
+     * Files hashed with TTH are split into the aligned chunks (complete
+     * subtrees) hashed as separate tasks, so a large file is spread over
+     * the workers.  The others are hashed by one task.
+     *
+     * @param scheduler The scheduler
+     * @param job       The job (`digest` or `error` is filled)
+     * @param done      Called from a worker once the JOB is completed
+     * @param chunkSize Bytes in a TTH chunk (`LEAF_SIZE` times a power of 2)
+     */
+    void HashJob (Scheduler &scheduler, Job &job, std::function<void (Job &)> done, uint64_t chunkSize = DEFAULT_CHUNK_SIZE);
+}  // namespace TigerSum
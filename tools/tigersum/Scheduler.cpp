@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+
+#include "Scheduler.hpp"
+
+#include <algorithm>
+
+namespace TigerSum {
+    namespace {
+        /// Index of the worker running on this thread (or ~0 outside of the workers).
+        thread_local size_t current_worker = ~static_cast<size_t> (0);
+    }  // namespace
+
+    Scheduler::Scheduler (size_t cntThread) {
+        if (cntThread == 0) {
+            cntThread = std::max<size_t> (1, std::thread::hardware_concurrency ());
+        }
+        for (size_t i = 0; i < cntThread; ++i) {
+            queues_.emplace_back (new Queue);
+        }
+        workers_.reserve (cntThread);
+        for (size_t i = 0; i < cntThread; ++i) {
+            workers_.emplace_back ([this, i] () { Run (i); });
+        }
+    }
+
+    Scheduler::~Scheduler () {
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            quit_ = true;
+        }
+        wakeup_.notify_all ();
+        for (auto &t : workers_) {
+            t.join ();
+        }
+    }
+
+    void Scheduler::Submit (task_t task) {
+        auto self = current_worker;
+        if (queues_.size () <= self) {
+            self = next_.fetch_add (1, std::memory_order_relaxed) % queues_.size ();
+        }
+        {
+            auto                       &q = *queues_[self];
+            std::lock_guard<std::mutex> lock (q.mutex);
+            q.tasks.emplace_back (std::move (task));
+        }
+        {
+            // Taken to avoid the lost wake-up against the sleeping workers.
+            std::lock_guard<std::mutex> lock (mutex_);
+            cntQueued_.fetch_add (1, std::memory_order_release);
+        }
+        wakeup_.notify_one ();
+    }
+
+    bool Scheduler::TryPop (size_t self, task_t &task) {
+        {
+            auto                       &q = *queues_[self];
+            std::lock_guard<std::mutex> lock (q.mutex);
+            if (! q.tasks.empty ()) {
+                task = std::move (q.tasks.back ());
+                q.tasks.pop_back ();
+                return true;
+            }
+        }
+        for (size_t i = 1; i < queues_.size (); ++i) {
+            auto                       &q = *queues_[(self + i) % queues_.size ()];
+            std::lock_guard<std::mutex> lock (q.mutex);
+            if (! q.tasks.empty ()) {
+                task = std::move (q.tasks.front ());
+                q.tasks.pop_front ();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Scheduler::Run (size_t self) {
+        current_worker = self;
+        for (;;) {
+            task_t task;
+            if (TryPop (self, task)) {
+                cntQueued_.fetch_sub (1, std::memory_order_relaxed);
+                task ();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock (mutex_);
+            wakeup_.wait (lock, [this] () { return quit_ || 0 < cntQueued_.load (std::memory_order_acquire); });
+            if (quit_) {
+                return;
+            }
+        }
+    }
+}  // namespace TigerSum
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief Work-stealing task scheduler.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TigerSum {
+    /**
+     * A work-stealing task scheduler.
+     *
+     * Every worker owns a deque.  Tasks submitted by a worker go to the
+     * back of its own deque and are run LIFO, so a task splitting itself
+     * keeps its pieces hot in the cache.  Idle workers steal from the
+     * front (the oldest, i.e. the largest remaining pieces) of the others.
+     * Tasks submitted from the outside are spread round-robin.
+     */
+    class Scheduler {
+    public:
+        using task_t = std::function<void ()>;
+
+    private:
+        struct Queue {
+            std::mutex         mutex;
+            std::deque<task_t> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread>            workers_;
+        std::mutex                          mutex_;
+        std::condition_variable             wakeup_;
+        std::atomic<size_t>                 cntQueued_ {0};
+        std::atomic<size_t>                 next_ {0};
+        bool                                quit_ = false;
+
+    public:
+        /**
+         * The constructor.
+         *
+         * @param cntThread # of workers.  0 uses all hardware threads.
+         */
+        explicit Scheduler (size_t cntThread);
+
+        Scheduler (const Scheduler &) = delete;
+        Scheduler &operator= (const Scheduler &) = delete;
+
+        /** Stops the workers (the queued tasks are discarded).  */
+        ~Scheduler ();
+
+        /** # of workers.  */
+        size_t Size () const { return workers_.size (); }
+
+        /**
+         * Queues a task.
+         *
+         * @param task The task (must not throw)
+         */
+        void Submit (task_t task);
+
+    private:
+        void Run (size_t self);
+        bool TryPop (size_t self, task_t &task);
+    };
+}  // namespace TigerSum
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2019  Masashi Fujita.  All rights reserved.
+ */
+/// @file
+/// @brief tigersum: Computes and checks Tiger/Tiger2/TTH checksums.
+
+#include "CheckList.hpp"
+#include "Checksum.hpp"
+#include "Scheduler.hpp"
+
+#include <fmt/format.h>
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+    using TigerSum::Algorithm;
+    using TigerSum::Entry;
+    using TigerSum::Job;
+
+    struct Options {
+        Algorithm algorithm = Algorithm::Tiger;
+        bool      check     = false;
+        bool      tag       = false;
+        bool      quiet     = false;
+        size_t    cntThread = 0;
+    };
+
+    void usage (FILE *out) {
+        fmt::print (out,
+                    "Usage: tigersum [OPTION]... [FILE]...\n"
+                    "Prints or checks Tiger checksums.  With no FILE, or when FILE is -, reads the standard input.\n"
+                    "\n"
+                    "  -c, --check     Reads checksums from the FILEs and checks them\n"
+                    "  -2, --tiger2    Uses the Tiger2 padding\n"
+                    "  -t, --tth       Computes the Tiger Tree Hash (THEX, printed in base32) instead\n"
+                    "      --tag       Prints the BSD style checksums\n"
+                    "  -j, --jobs N    # of threads (default: all hardware threads)\n"
+                    "  -q, --quiet     Does not print OK for the verified files\n"
+                    "  -h, --help      Shows this help\n"
+                    "\n"
+                    "The check lines are in either the \"DIGEST  FILE\" or the \"ALGORITHM (FILE) = DIGEST\" form.\n");
+    }
+
+    /**
+     * Collects the check lines from the FILE.
+     *
+     * @return # of malformed lines
+     * @throws std::system_error if FILE could not be read
+     */
+    size_t read_check_file (const std::string &file, Algorithm algorithm, std::vector<Entry> &entries) {
+        if (file == "-") {
+            return TigerSum::ReadCheckList (std::cin, algorithm, entries);
+        }
+        std::ifstream in (file);
+        if (! in) {
+            throw std::system_error (errno != 0 ? errno : ENOENT, std::generic_category (), file);
+        }
+        auto result = TigerSum::ReadCheckList (in, algorithm, entries);
+        if (in.bad ()) {
+            throw std::system_error (errno != 0 ? errno : EIO, std::generic_category (), file);
+        }
+        return result;
+    }
+
+    /**
+     * Hashes the ENTRIES in parallel and reports them in order.
+     *
+     * At most WINDOW entries are in flight, which bounds the memory for
+     * an arbitrarily long list.
+     *
+     * @return # of failed entries
+     */
+    size_t run (const std::vector<Entry> &entries, const Options &options) {
+        TigerSum::Scheduler scheduler (options.cntThread);
+
+        std::mutex              mutex;
+        std::condition_variable cond;
+        auto                    done = [&mutex, &cond] (Job &job) {
+            {
+                std::lock_guard<std::mutex> lock (mutex);
+                job.done = true;
+            }
+            cond.notify_all ();
+        };
+
+        size_t const window = 4 * scheduler.Size ();
+
+        std::deque<std::unique_ptr<Job>> inflight;
+        size_t                           next       = 0;
+        size_t                           cntFailure = 0;
+        while (next < entries.size () || ! inflight.empty ()) {
+            while (next < entries.size () && inflight.size () < window) {
+                auto const &e = entries[next++];
+                inflight.emplace_back (new Job);
+                auto &job     = *inflight.back ();
+                job.path      = e.path;
+                job.algorithm = e.algorithm;
+                job.expected  = e.expected;
+                TigerSum::HashJob (scheduler, job, done);
+            }
+            auto &job = *inflight.front ();
+            {
+                std::unique_lock<std::mutex> lock (mutex);
+                cond.wait (lock, [&job] () { return job.done; });
+            }
+            if (! job.error.empty ()) {
+                ++cntFailure;
+                fmt::print (stderr, "tigersum: {}: {}\n", job.path, job.error);
+                if (options.check) {
+                    fmt::print ("{}: FAILED open or read\n", job.path);
+                }
+            }
+            else if (options.check) {
+                bool ok = TigerSum::FormatDigest (job.algorithm, job.digest) == job.expected;
+                if (! ok) {
+                    ++cntFailure;
+                    fmt::print ("{}: FAILED\n", job.path);
+                }
+                else if (! options.quiet) {
+                    fmt::print ("{}: OK\n", job.path);
+                }
+            }
+            else if (options.tag) {
+                fmt::print ("{} ({}) = {}\n", TigerSum::AlgorithmName (job.algorithm), job.path, TigerSum::FormatDigest (job.algorithm, job.digest));
+            }
+            else {
+                fmt::print ("{}  {}\n", TigerSum::FormatDigest (job.algorithm, job.digest), job.path);
+            }
+            inflight.pop_front ();
+        }
+        std::fflush (stdout);
+        return cntFailure;
+    }
+}  // namespace
+
+int main (int argc, char **argv) {
+    Options                  options;
+    bool                     tiger2 = false;
+    bool                     tth    = false;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-c" || arg == "--check") {
+            options.check = true;
+        }
+        else if (arg == "-2" || arg == "--tiger2") {
+            tiger2 = true;
+        }
+        else if (arg == "-t" || arg == "--tth") {
+            tth = true;
+        }
+        else if (arg == "--tag") {
+            options.tag = true;
+        }
+        else if (arg == "-q" || arg == "--quiet") {
+            options.quiet = true;
+        }
+        else if (arg == "-j" || arg == "--jobs") {
+            const char *value = i + 1 < argc ? argv[++i] : "";
+            char       *end   = nullptr;
+            errno             = 0;
+            auto n            = std::strtoul (value, &end, 10);
+            if (*value < '0' || '9' < *value || *end != 0 || errno != 0) {
+                fmt::print (stderr, "tigersum: Invalid # of jobs: {}\n", value);
+                usage (stderr);
+                return 2;
+            }
+            options.cntThread = static_cast<size_t> (n);
+        }
+        else if (arg == "-h" || arg == "--help") {
+            usage (stdout);
+            return 0;
+        }
+        else if (arg == "--") {
+            files.insert (files.end (), argv + i + 1, argv + argc);
+            break;
+        }
+        else if (1 < arg.size () && arg[0] == '-') {
+            fmt::print (stderr, "tigersum: Unknown option: {}\n", arg);
+            usage (stderr);
+            return 2;
+        }
+        else {
+            files.emplace_back (std::move (arg));
+        }
+    }
+    if (tiger2 && tth) {
+        fmt::print (stderr, "tigersum: --tiger2 and --tth are exclusive\n");
+        return 2;
+    }
+    options.algorithm = tth ? Algorithm::TTH : tiger2 ? Algorithm::Tiger2 : Algorithm::Tiger;
+    if (files.empty ()) {
+        files.emplace_back ("-");
+    }
+
+    std::vector<Entry> entries;
+    int                status = 0;
+    if (options.check) {
+        size_t cntMalformed = 0;
+        for (auto const &file : files) {
+            try {
+                auto const cntEntry = entries.size ();
+                cntMalformed += read_check_file (file, options.algorithm, entries);
+                if (entries.size () == cntEntry) {
+                    fmt::print (stderr, "tigersum: {}: no properly formatted checksum lines found\n", file);
+                    status = 1;
+                }
+            }
+            catch (const std::system_error &e) {
+                fmt::print (stderr, "tigersum: {}: {}\n", file, e.code ().message ());
+                status = 1;
+            }
+        }
+        if (0 < cntMalformed) {
+            fmt::print (stderr, "tigersum: WARNING: {} line(s) are improperly formatted\n", cntMalformed);
+        }
+    }
+    else {
+        for (auto const &file : files) {
+            entries.emplace_back (Entry {file, options.algorithm, std::string {}});
+        }
+    }
+    auto cntFailure = run (entries, options);
+    if (options.check && 0 < cntFailure) {
+        fmt::print (stderr, "tigersum: WARNING: {} of {} file(s) did NOT match\n", cntFailure, entries.size ());
+    }
+    return 0 < cntFailure ? 1 : status;
+}